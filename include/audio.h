@@ -0,0 +1,114 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Audio input sample period, in microseconds. On AVR the ADC runs free at 16MHz / 128 / 13 and
+// every 4 conversions are averaged, i.e. one sample every 416us (2404Hz).
+#define AUDIO_SAMPLE_PERIOD 416
+#define AUDIO_SAMPLE_RATE (1000000L / AUDIO_SAMPLE_PERIOD)
+
+// Samples buffered between two loops, a power of 2. 128 samples is about 53ms.
+#define AUDIO_RING_SIZE 128
+
+// Number of samples analyzed at once and number of bands, see SpectrumAnalyzer.
+#define AUDIO_BLOCK_SIZE 64
+#define AUDIO_BANDS 8
+
+// AudioInput samples the given analog pin at AUDIO_SAMPLE_RATE into a ring buffer, 8 bits unsigned.
+// On AVR the ADC runs free and fills the ring from its interrupt, elsewhere poll() reads the channel
+// when samples are due, e.g. A0 on the ESP8266. Only one input can run at a time.
+class AudioInput {
+   public:
+    AudioInput(uint8_t pin = A0) : _pin(pin) {}
+
+    ~AudioInput() {
+        this->end();
+    }
+
+    void begin();
+    void end();
+
+    // Read the samples due since the last call. No-op on AVR where the interrupt does it.
+    void poll();
+
+    // Pop the oldest buffered sample, false when empty.
+    bool read(uint8_t& sample) {
+        if (this->_tail == this->_head) {
+            return false;
+        }
+        sample = this->_ring[this->_tail];
+        this->_tail = (this->_tail + 1) & (AUDIO_RING_SIZE - 1);
+        return true;
+    }
+
+    // Samples dropped because the ring was full, i.e. the loop was too slow to consume them.
+    uint16_t overruns() const {
+        return this->_overruns;
+    }
+
+    // Feed a raw 8 bits conversion, called from the ADC interrupt.
+    void convert(uint8_t value);
+
+    // Input currently running, if any.
+    static AudioInput* active() {
+        return _active;
+    }
+
+   private:
+    void push(uint8_t sample) {
+        const uint8_t next = (this->_head + 1) & (AUDIO_RING_SIZE - 1);
+        if (next == this->_tail) {
+            this->_overruns++;
+            return;
+        }
+        this->_ring[this->_head] = sample;
+        this->_head = next;
+    }
+
+   private:
+    uint8_t _pin;
+
+    uint8_t _ring[AUDIO_RING_SIZE];
+    // Head is written by the interrupt, tail by the loop.
+    volatile uint8_t _head = 0;
+    volatile uint8_t _tail = 0;
+    volatile uint16_t _overruns = 0;
+
+    // Decimation of the free running conversions.
+    uint16_t _sum = 0;
+    uint8_t _count = 0;
+    // Time of the next polled sample.
+    unsigned long _next = 0;
+
+    static AudioInput* _active;
+};
+
+// SpectrumAnalyzer turns the samples into AUDIO_BANDS band magnitudes, with a Hann windowed 64 points FFT
+// over blocks of AUDIO_BLOCK_SIZE samples. Its 37.6Hz bins from 75Hz up are summed into log spaced bands,
+// 75, 113, 150-188, 225-263, 300-376, 413-526, 564-751 and 789-1164Hz, so every tone in that range
+// shows up in a band. The FFT runs once per block, with its 256 bytes of work buffers on the stack.
+//
+// The input is sampled at 2404Hz: anything above 1.2kHz folds back into the bands, e.g. 1600Hz reads
+// as 800Hz. Averaging 4 ADC conversions per sample only halves it at 1.6kHz, the microphone needs an
+// analog low pass below 1.2kHz, e.g. an RC filter, for the bands to be clean.
+class SpectrumAnalyzer {
+   public:
+    // Add a sample, returns true when a block got completed and the bands updated.
+    bool feed(uint8_t sample);
+
+    // Magnitude of the given band for the last completed block, about 254 for a full scale sine.
+    uint16_t band(uint8_t i) const {
+        return this->_bands[i];
+    }
+
+   private:
+    void analyze();
+
+   private:
+    // Microphone DC bias, in 8.8 fixed point.
+    uint16_t _bias = 128 << 8;
+    uint8_t _count = 0;
+    // Samples of the block, less the bias.
+    int8_t _block[AUDIO_BLOCK_SIZE];
+    uint16_t _bands[AUDIO_BANDS] = {};
+};
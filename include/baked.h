@@ -0,0 +1,838 @@
+#pragma once
+
+// Generated by `ledcube bake include/baked.h 1024 100000`, do not edit.
+//
+// Smallest tables first. A table is kept when it fits in what the previous ones left of
+// BAKED_FLASH_BUDGET, BAKED_BYTES_<n> being their total. Step times are measured on the host only,
+// they just leave out the effects whose replay is no faster and are not listed here.
+// effect          lead  cycle  bytes
+// woopWoop           1      6    252
+// ripple             1     32   1046
+// plasma             1    256   2400
+// sineWave           1    128   5651
+
+#include <Arduino.h>
+
+#include "cachedeffect.h"
+
+#define BAKED_BYTES_0 0
+
+#if BAKED_FLASH_BUDGET >= BAKED_BYTES_0 + 252
+#define BAKED_WOOP_WOOP
+#define BAKED_BYTES_1 (BAKED_BYTES_0 + 252)
+static const uint8_t bakedWoopWoopData[] PROGMEM = {
+    0x00, 0x3c, 0x3c, 0x3c, 0x24, 0x24, 0x3c, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x3c, 0x3c, 0x24, 0x24, 0x3c, 0x7e, 0x7e, 0x7e, 0x42, 0x42, 0x42,
+    0x42, 0x7e, 0x7e, 0x42, 0x3c, 0x24, 0x24, 0x3c, 0x42, 0x66, 0x42, 0x24,
+    0x24, 0x42, 0x66, 0x42, 0x24, 0x24, 0x42, 0x7e, 0x42, 0x3c, 0x24, 0x24,
+    0x3c, 0x42, 0x7e, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x7e, 0xff, 0xff, 0xff,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xff, 0xff, 0x81, 0x7e, 0x42, 0x42,
+    0x42, 0x42, 0x7e, 0x81, 0xc3, 0x81, 0x42, 0x42, 0x81, 0xc3, 0x81, 0x42,
+    0x42, 0x81, 0xc3, 0x81, 0x42, 0x42, 0x81, 0xc3, 0x81, 0x42, 0x42, 0x81,
+    0xff, 0x81, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x81, 0xff, 0xff, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0xff, 0xff, 0x81, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x7e,
+    0x81, 0xc3, 0x81, 0x42, 0x42, 0x81, 0xc3, 0x81, 0x42, 0x42, 0x81, 0xc3,
+    0x81, 0x42, 0x42, 0x81, 0xc3, 0x81, 0x42, 0x42, 0x81, 0xff, 0x81, 0x7e,
+    0x42, 0x42, 0x42, 0x42, 0x7e, 0x81, 0xff, 0xff, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0xff, 0x7e, 0x7e, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x7e,
+    0x42, 0x3c, 0x24, 0x24, 0x3c, 0x42, 0x66, 0x42, 0x24, 0x24, 0x42, 0x66,
+    0x42, 0x24, 0x24, 0x42, 0x7e, 0x42, 0x3c, 0x24, 0x24, 0x3c, 0x42, 0x7e,
+    0x7e, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x3c, 0x3c, 0x3c, 0x24, 0x24, 0x3c,
+    0x3c, 0x24, 0x18, 0x18, 0x24, 0x3c, 0x24, 0x18, 0x18, 0x24, 0x3c, 0x3c,
+    0x24, 0x24, 0x3c, 0x3c, 0x3c, 0x3c, 0x24, 0x24, 0x3c, 0x3c, 0x24, 0x18,
+    0x18, 0x24, 0x3c, 0x24, 0x18, 0x18, 0x24, 0x3c, 0x3c, 0x24, 0x24, 0x3c,
+};
+constexpr BakedFrames bakedWoopWoop = {bakedWoopWoopData, 231, 18};
+#else
+#define BAKED_BYTES_1 BAKED_BYTES_0
+#endif
+
+#if BAKED_FLASH_BUDGET >= BAKED_BYTES_1 + 1046
+#define BAKED_RIPPLE
+#define BAKED_BYTES_2 (BAKED_BYTES_1 + 1046)
+static const uint8_t bakedRippleData[] PROGMEM = {
+    0x00, 0xdb, 0xff, 0x18, 0x66, 0x42, 0x81, 0x81, 0x42, 0x66, 0x18, 0x5a,
+    0x18, 0x42, 0x42, 0x18, 0xa5, 0x24, 0x81, 0x81, 0x24, 0x24, 0x24, 0x24,
+    0xff, 0x42, 0x81, 0x18, 0x24, 0x24, 0x18, 0x81, 0x42, 0x99, 0x81, 0x18,
+    0x18, 0x81, 0xec, 0xa5, 0x24, 0x81, 0x81, 0x24, 0xa5, 0x24, 0x81, 0x81,
+    0x24, 0xc3, 0x42, 0x81, 0x81, 0x42, 0xff, 0x42, 0x81, 0x18, 0x3c, 0x3c,
+    0x18, 0x81, 0x42, 0x3c, 0x18, 0x3c, 0x3c, 0x18, 0x36, 0xff, 0x24, 0x18,
+    0x81, 0x42, 0x42, 0x81, 0x18, 0x24, 0xff, 0x24, 0x18, 0x81, 0x42, 0x42,
+    0x81, 0x18, 0x24, 0xe7, 0x42, 0x81, 0x24, 0x24, 0x81, 0x42, 0xe7, 0x42,
+    0x81, 0x24, 0x24, 0x81, 0x42, 0xfc, 0x5a, 0x18, 0x42, 0x42, 0x18, 0xdb,
+    0x42, 0x99, 0x42, 0x42, 0x99, 0x42, 0xc3, 0x42, 0x81, 0x81, 0x42, 0x3c,
+    0x24, 0x18, 0x18, 0x24, 0xbd, 0x81, 0x24, 0x18, 0x18, 0x24, 0x81, 0x81,
+    0x81, 0x81, 0x7b, 0xe7, 0x24, 0x24, 0xc3, 0xc3, 0x24, 0x24, 0xe7, 0x24,
+    0x24, 0xc3, 0xc3, 0x24, 0x24, 0x5a, 0x18, 0x42, 0x42, 0x18, 0x5a, 0x18,
+    0x5a, 0x5a, 0x18, 0x99, 0x81, 0x18, 0x18, 0x81, 0x81, 0x81, 0x81, 0xde,
+    0x66, 0x24, 0x42, 0x42, 0x24, 0xe7, 0x42, 0xa5, 0x42, 0x42, 0xa5, 0x42,
+    0xdb, 0x42, 0x81, 0x18, 0x18, 0x81, 0x42, 0x18, 0x18, 0x18, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x36, 0xc3, 0x42, 0x81, 0x81, 0x42, 0xc3, 0x42,
+    0x81, 0x81, 0x42, 0xdb, 0x81, 0x18, 0x42, 0x42, 0x18, 0x81, 0xdb, 0x81,
+    0x18, 0x42, 0x42, 0x18, 0x81, 0x7f, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42,
+    0x18, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42, 0x18, 0x7e, 0x24, 0x42, 0x18,
+    0x18, 0x42, 0x24, 0xff, 0x81, 0x24, 0x42, 0x18, 0x18, 0x42, 0x24, 0x81,
+    0x81, 0x81, 0x81, 0x5a, 0x18, 0x42, 0x42, 0x18, 0x5a, 0x18, 0x42, 0x42,
+    0x18, 0xdf, 0xc3, 0x42, 0x81, 0x81, 0x42, 0xdb, 0x42, 0x81, 0x18, 0x18,
+    0x81, 0x42, 0x99, 0x81, 0x18, 0x18, 0x81, 0xe7, 0x81, 0x24, 0x42, 0x42,
+    0x24, 0x81, 0x66, 0x24, 0x42, 0x42, 0x24, 0x3c, 0x18, 0x24, 0x24, 0x18,
+    0x3c, 0x18, 0x24, 0x24, 0x18, 0xf6, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42,
+    0x18, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42, 0x18, 0x66, 0x24, 0x42, 0x42,
+    0x24, 0x66, 0x24, 0x42, 0x42, 0x24, 0x5a, 0x18, 0x42, 0x42, 0x18, 0x5a,
+    0x18, 0x42, 0x42, 0x18, 0x6f, 0x18, 0x18, 0x18, 0x99, 0x81, 0x18, 0x18,
+    0x81, 0xdb, 0x99, 0x42, 0x81, 0x81, 0x42, 0x99, 0xdb, 0x18, 0x42, 0x81,
+    0x81, 0x42, 0x18, 0x3c, 0x18, 0x24, 0x24, 0x18, 0x3c, 0x18, 0x24, 0x24,
+    0x18, 0x73, 0xa5, 0xa5, 0x81, 0x81, 0xa5, 0xa5, 0xa5, 0x81, 0x81, 0xa5,
+    0x3c, 0x18, 0x24, 0x24, 0x18, 0x7e, 0x24, 0x5a, 0x24, 0x24, 0x5a, 0x24,
+    0x66, 0x24, 0x42, 0x42, 0x24, 0xd8, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42,
+    0x18, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42, 0x18, 0x66, 0x24, 0x66, 0x66,
+    0x24, 0x66, 0x24, 0x66, 0x66, 0x24, 0x3e, 0xa5, 0x24, 0x81, 0x81, 0x24,
+    0xa5, 0x24, 0x81, 0x81, 0x24, 0x3c, 0x18, 0x24, 0x24, 0x18, 0xff, 0x18,
+    0x42, 0x18, 0xa5, 0xa5, 0x18, 0x42, 0x18, 0xdb, 0x18, 0x42, 0x81, 0x81,
+    0x42, 0x18, 0x6c, 0xbd, 0x24, 0x99, 0x24, 0x24, 0x99, 0x24, 0xbd, 0x24,
+    0x99, 0x24, 0x24, 0x99, 0x24, 0xff, 0x18, 0x42, 0x24, 0x81, 0x81, 0x24,
+    0x42, 0x18, 0xff, 0x18, 0x42, 0x24, 0x81, 0x81, 0x24, 0x42, 0x18, 0x3f,
+    0xc3, 0x42, 0x81, 0x81, 0x42, 0xff, 0x42, 0x81, 0x18, 0x24, 0x24, 0x18,
+    0x81, 0x42, 0x3c, 0x18, 0x24, 0x24, 0x18, 0xa5, 0x24, 0x81, 0x81, 0x24,
+    0xa5, 0x24, 0xa5, 0xa5, 0x24, 0x24, 0x24, 0x24, 0xc0, 0xdb, 0x18, 0x5a,
+    0xc3, 0xc3, 0x5a, 0x18, 0xdb, 0x18, 0x5a, 0xc3, 0xc3, 0x5a, 0x18, 0x3f,
+    0x3c, 0x18, 0x3c, 0x3c, 0x18, 0xff, 0x42, 0x81, 0x18, 0x3c, 0x3c, 0x18,
+    0x81, 0x42, 0xc3, 0x42, 0x81, 0x81, 0x42, 0x24, 0x24, 0x24, 0xa5, 0x24,
+    0xa5, 0xa5, 0x24, 0xa5, 0x24, 0x81, 0x81, 0x24, 0x6c, 0xe7, 0x42, 0x81,
+    0x24, 0x24, 0x81, 0x42, 0xe7, 0x42, 0x81, 0x24, 0x24, 0x81, 0x42, 0xff,
+    0x24, 0x18, 0x81, 0x42, 0x42, 0x81, 0x18, 0x24, 0xff, 0x24, 0x18, 0x81,
+    0x42, 0x42, 0x81, 0x18, 0x24, 0x3f, 0x81, 0x81, 0x81, 0xbd, 0x81, 0x24,
+    0x18, 0x18, 0x24, 0x81, 0x3c, 0x24, 0x18, 0x18, 0x24, 0xc3, 0x42, 0x81,
+    0x81, 0x42, 0xdb, 0x42, 0x99, 0x42, 0x42, 0x99, 0x42, 0x5a, 0x18, 0x42,
+    0x42, 0x18, 0xde, 0x81, 0x81, 0x81, 0x99, 0x81, 0x18, 0x18, 0x81, 0x5a,
+    0x18, 0x5a, 0x5a, 0x18, 0x5a, 0x18, 0x42, 0x42, 0x18, 0xe7, 0x24, 0x24,
+    0xc3, 0xc3, 0x24, 0x24, 0xe7, 0x24, 0x24, 0xc3, 0xc3, 0x24, 0x24, 0x7b,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x18, 0x18, 0x18, 0xdb, 0x42, 0x81,
+    0x18, 0x18, 0x81, 0x42, 0xe7, 0x42, 0xa5, 0x42, 0x42, 0xa5, 0x42, 0x66,
+    0x24, 0x42, 0x42, 0x24, 0x6c, 0xdb, 0x81, 0x18, 0x42, 0x42, 0x18, 0x81,
+    0xdb, 0x81, 0x18, 0x42, 0x42, 0x18, 0x81, 0xc3, 0x42, 0x81, 0x81, 0x42,
+    0xc3, 0x42, 0x81, 0x81, 0x42, 0xfe, 0x5a, 0x18, 0x42, 0x42, 0x18, 0x5a,
+    0x18, 0x42, 0x42, 0x18, 0x81, 0x81, 0x81, 0xff, 0x81, 0x24, 0x42, 0x18,
+    0x18, 0x42, 0x24, 0x81, 0x7e, 0x24, 0x42, 0x18, 0x18, 0x42, 0x24, 0xdb,
+    0x18, 0x42, 0x81, 0x81, 0x42, 0x18, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42,
+    0x18, 0xfb, 0x3c, 0x18, 0x24, 0x24, 0x18, 0x3c, 0x18, 0x24, 0x24, 0x18,
+    0x66, 0x24, 0x42, 0x42, 0x24, 0xe7, 0x81, 0x24, 0x42, 0x42, 0x24, 0x81,
+    0x99, 0x81, 0x18, 0x18, 0x81, 0xdb, 0x42, 0x81, 0x18, 0x18, 0x81, 0x42,
+    0xc3, 0x42, 0x81, 0x81, 0x42, 0x6f, 0x5a, 0x18, 0x42, 0x42, 0x18, 0x5a,
+    0x18, 0x42, 0x42, 0x18, 0x66, 0x24, 0x42, 0x42, 0x24, 0x66, 0x24, 0x42,
+    0x42, 0x24, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42, 0x18, 0xdb, 0x18, 0x42,
+    0x81, 0x81, 0x42, 0x18, 0xf6, 0x3c, 0x18, 0x24, 0x24, 0x18, 0x3c, 0x18,
+    0x24, 0x24, 0x18, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42, 0x18, 0xdb, 0x99,
+    0x42, 0x81, 0x81, 0x42, 0x99, 0x99, 0x81, 0x18, 0x18, 0x81, 0x18, 0x18,
+    0x18, 0xce, 0x66, 0x24, 0x42, 0x42, 0x24, 0x7e, 0x24, 0x5a, 0x24, 0x24,
+    0x5a, 0x24, 0x3c, 0x18, 0x24, 0x24, 0x18, 0xa5, 0xa5, 0x81, 0x81, 0xa5,
+    0xa5, 0xa5, 0x81, 0x81, 0xa5, 0x1b, 0x66, 0x24, 0x66, 0x66, 0x24, 0x66,
+    0x24, 0x66, 0x66, 0x24, 0xdb, 0x18, 0x42, 0x81, 0x81, 0x42, 0x18, 0xdb,
+    0x18, 0x42, 0x81, 0x81, 0x42, 0x18, 0x7c, 0xdb, 0x18, 0x42, 0x81, 0x81,
+    0x42, 0x18, 0xff, 0x18, 0x42, 0x18, 0xa5, 0xa5, 0x18, 0x42, 0x18, 0x3c,
+    0x18, 0x24, 0x24, 0x18, 0xa5, 0x24, 0x81, 0x81, 0x24, 0xa5, 0x24, 0x81,
+    0x81, 0x24, 0x36, 0xff, 0x18, 0x42, 0x24, 0x81, 0x81, 0x24, 0x42, 0x18,
+    0xff, 0x18, 0x42, 0x24, 0x81, 0x81, 0x24, 0x42, 0x18, 0xbd, 0x24, 0x99,
+    0x24, 0x24, 0x99, 0x24, 0xbd, 0x24, 0x99, 0x24, 0x24, 0x99, 0x24, 0xec,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x3c, 0x18, 0x24, 0x24, 0x18, 0xff,
+    0x42, 0x81, 0x18, 0x24, 0x24, 0x18, 0x81, 0x42, 0xc3, 0x42, 0x81, 0x81,
+    0x42, 0x1b, 0xdb, 0x18, 0x5a, 0xc3, 0xc3, 0x5a, 0x18, 0xdb, 0x18, 0x5a,
+    0xc3, 0xc3, 0x5a, 0x18, 0xa5, 0x24, 0xa5, 0xa5, 0x24, 0xa5, 0x24, 0xa5,
+    0xa5, 0x24,
+};
+constexpr BakedFrames bakedRipple = {bakedRippleData, 1021, 38};
+#else
+#define BAKED_BYTES_2 BAKED_BYTES_1
+#endif
+
+#if BAKED_FLASH_BUDGET >= BAKED_BYTES_2 + 2400
+#define BAKED_PLASMA
+#define BAKED_BYTES_3 (BAKED_BYTES_2 + 2400)
+static const uint8_t bakedPlasmaData[] PROGMEM = {
+    0x00, 0x3f, 0x3f, 0x7c, 0x7e, 0xff, 0x7f, 0x3f, 0x1e, 0x7f, 0x7e, 0xff,
+    0xff, 0xff, 0x7f, 0x3f, 0x0e, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f,
+    0x0f, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x1f, 0x1f, 0x3e, 0x3f, 0x3f,
+    0x3f, 0x1f, 0x0f, 0x0c, 0x1e, 0x1f, 0x0f, 0x27, 0x12, 0x80, 0x40, 0x01,
+    0x80, 0x40, 0x01, 0x08, 0x01, 0x23, 0x68, 0x80, 0x20, 0x0c, 0x40, 0x10,
+    0x05, 0x04, 0x01, 0x28, 0x04, 0x80, 0x08, 0x02, 0x39, 0x01, 0x80, 0x03,
+    0x01, 0x80, 0x10, 0x01, 0x03, 0x08, 0x02, 0x2e, 0x10, 0x80, 0x41, 0x01,
+    0x02, 0x20, 0x01, 0x08, 0x0c, 0x31, 0x40, 0x10, 0x13, 0x02, 0x01, 0x12,
+    0x04, 0x02, 0x0b, 0x10, 0x80, 0x20, 0x40, 0x20, 0x02, 0x1d, 0x20, 0x40,
+    0x40, 0x04, 0x20, 0x10, 0x18, 0x01, 0x0c, 0x3e, 0x40, 0x02, 0x40, 0x08,
+    0x20, 0x04, 0x04, 0x01, 0x02, 0x04, 0x2c, 0x20, 0x01, 0x30, 0x01, 0x08,
+    0x04, 0x04, 0x39, 0x40, 0x20, 0x03, 0x02, 0x01, 0x0b, 0x04, 0x02, 0x02,
+    0x04, 0x10, 0x18, 0x01, 0x80, 0x08, 0x20, 0xbe, 0x20, 0x01, 0x20, 0x02,
+    0x10, 0x02, 0x04, 0x02, 0x04, 0x08, 0x02, 0x18, 0x9c, 0x03, 0x02, 0x01,
+    0x0c, 0x01, 0x01, 0x08, 0x04, 0x04, 0x18, 0xae, 0x41, 0x02, 0x04, 0x10,
+    0x01, 0x10, 0x04, 0x02, 0x08, 0x03, 0x18, 0x04, 0xdf, 0x20, 0x80, 0x02,
+    0x01, 0x20, 0x04, 0x13, 0x04, 0x02, 0x20, 0x0b, 0x08, 0x44, 0x08, 0x02,
+    0x10, 0x02, 0x20, 0xdd, 0x10, 0x01, 0x20, 0x20, 0x18, 0x02, 0x08, 0x0c,
+    0x04, 0x10, 0x02, 0x08, 0x05, 0x20, 0x24, 0x0f, 0x60, 0x02, 0x04, 0x70,
+    0x01, 0x02, 0x08, 0x3c, 0x01, 0x01, 0x02, 0x08, 0x14, 0x02, 0x10, 0xe4,
+    0x20, 0x10, 0x02, 0x20, 0x07, 0x10, 0x20, 0x10, 0x03, 0x04, 0x40, 0xcf,
+    0x44, 0x01, 0x40, 0x40, 0x10, 0x02, 0x02, 0x08, 0x04, 0x01, 0x20, 0x07,
+    0x40, 0x02, 0x40, 0x4f, 0x08, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x04, 0x02,
+    0x04, 0x04, 0x28, 0xfe, 0x30, 0x02, 0x04, 0x1c, 0x02, 0x02, 0x04, 0x01,
+    0x08, 0x04, 0x08, 0x05, 0x20, 0x10, 0x03, 0x08, 0x40, 0x0c, 0x02, 0x30,
+    0xfa, 0x02, 0x02, 0x0c, 0x04, 0x48, 0x03, 0x40, 0x08, 0x01, 0x10, 0x01,
+    0x40, 0x02, 0x81, 0xf7, 0x12, 0x02, 0x02, 0x01, 0x04, 0x10, 0x08, 0x01,
+    0x10, 0x06, 0x40, 0x20, 0x06, 0x04, 0x40, 0x05, 0x80, 0x81, 0xa7, 0x61,
+    0x04, 0x04, 0x08, 0x28, 0x02, 0x08, 0x1a, 0x04, 0x04, 0x40, 0x01, 0x40,
+    0x09, 0x02, 0x40, 0xce, 0x14, 0x02, 0x04, 0x10, 0x10, 0x08, 0x10, 0x03,
+    0x80, 0x80, 0x08, 0x08, 0x2f, 0x08, 0x02, 0x20, 0x50, 0x15, 0x08, 0x04,
+    0x20, 0x0e, 0x08, 0x08, 0x20, 0x02, 0x08, 0xf3, 0x44, 0x02, 0x10, 0x20,
+    0x20, 0x04, 0x40, 0x04, 0x40, 0x04, 0x84, 0x01, 0x01, 0xbf, 0x50, 0x04,
+    0x40, 0x0a, 0x04, 0x04, 0x08, 0x08, 0x01, 0x10, 0x06, 0x80, 0x10, 0x03,
+    0x80, 0x80, 0x08, 0x80, 0x53, 0x20, 0x08, 0x15, 0x08, 0x04, 0x08, 0x01,
+    0x80, 0x09, 0x04, 0x20, 0x45, 0x42, 0x04, 0x20, 0x06, 0x08, 0x08, 0x0a,
+    0x02, 0x40, 0x6d, 0x08, 0x04, 0x08, 0x10, 0x04, 0x10, 0x04, 0x80, 0x08,
+    0x10, 0x47, 0x05, 0x08, 0x04, 0x18, 0x08, 0x10, 0x09, 0x10, 0x80, 0x06,
+    0x01, 0x02, 0xcb, 0x30, 0x08, 0x10, 0x12, 0x08, 0x80, 0x02, 0x10, 0x04,
+    0x01, 0x08, 0x01, 0x76, 0x14, 0x08, 0x20, 0x08, 0x20, 0x04, 0x80, 0x05,
+    0x08, 0x08, 0x08, 0x80, 0x47, 0x20, 0xa0, 0x11, 0x10, 0x40, 0x06, 0x10,
+    0x10, 0x01, 0x02, 0x87, 0x0a, 0x08, 0x08, 0x08, 0x10, 0x08, 0x40, 0x08,
+    0x08, 0x21, 0x34, 0x08, 0x10, 0x40, 0x08, 0x40, 0x43, 0x01, 0x10, 0x06,
+    0x10, 0x10, 0x01, 0x01, 0x3e, 0x08, 0x20, 0x01, 0x20, 0x04, 0x20, 0x01,
+    0x10, 0x0a, 0x04, 0x20, 0x65, 0x18, 0x10, 0x20, 0x04, 0x20, 0x08, 0x80,
+    0x08, 0x01, 0x83, 0x02, 0x10, 0x01, 0x20, 0x08, 0x10, 0x07, 0x04, 0x10,
+    0x08, 0x40, 0x02, 0x20, 0x33, 0x10, 0x40, 0x04, 0x20, 0x04, 0x10, 0x06,
+    0x02, 0x04, 0xa3, 0x19, 0x20, 0x20, 0x80, 0x0a, 0x20, 0x80, 0x07, 0x04,
+    0x01, 0x01, 0x08, 0x20, 0x20, 0x04, 0x02, 0x91, 0x06, 0x20, 0x20, 0x08,
+    0x80, 0x08, 0x40, 0x45, 0x08, 0x40, 0x04, 0x40, 0x08, 0x10, 0xb2, 0x05,
+    0x40, 0x40, 0x08, 0x40, 0x01, 0x03, 0x08, 0x80, 0x00, 0x83, 0x09, 0x40,
+    0x80, 0x02, 0x40, 0x0c, 0x08, 0x01, 0xf1, 0x04, 0x40, 0x02, 0x08, 0x08,
+    0x01, 0x08, 0x20, 0x04, 0x14, 0x01, 0x02, 0x40, 0x82, 0x04, 0x80, 0x04,
+    0x20, 0xc0, 0x08, 0x40, 0x04, 0x02, 0x91, 0x04, 0x80, 0x02, 0x01, 0x04,
+    0x40, 0xf1, 0x01, 0x80, 0x01, 0x08, 0x08, 0x20, 0x08, 0x80, 0x02, 0x08,
+    0x90, 0x06, 0x02, 0x01, 0x07, 0x04, 0x14, 0x80, 0xd9, 0x02, 0x80, 0x08,
+    0x80, 0x03, 0x01, 0x04, 0x04, 0x08, 0x01, 0x08, 0xc0, 0x04, 0x10, 0x03,
+    0x10, 0x20, 0xc0, 0x04, 0x04, 0x01, 0x02, 0xf2, 0x01, 0x80, 0x85, 0x02,
+    0x02, 0x01, 0x88, 0x40, 0x01, 0x04, 0x20, 0x06, 0x42, 0x01, 0xd2, 0x02,
+    0x80, 0x01, 0x04, 0x08, 0x01, 0x01, 0x20, 0xc0, 0x04, 0x40, 0x02, 0x80,
+    0x70, 0x08, 0x40, 0x0c, 0x08, 0x80, 0x06, 0x08, 0x02, 0xf8, 0x80, 0x01,
+    0x08, 0x01, 0x04, 0x10, 0x07, 0x08, 0x14, 0x80, 0x01, 0x41, 0xf0, 0x40,
+    0x01, 0x04, 0x04, 0x03, 0x04, 0x20, 0x02, 0x01, 0xf8, 0x03, 0x01, 0x01,
+    0x84, 0x10, 0x02, 0x04, 0x20, 0x01, 0x10, 0x01, 0x80, 0x00, 0x68, 0x80,
+    0x02, 0x08, 0x01, 0x07, 0x22, 0x42, 0x01, 0x30, 0x08, 0x80, 0x06, 0x08,
+    0x40, 0x7c, 0x80, 0x01, 0x41, 0x02, 0x01, 0x0c, 0x20, 0x01, 0x07, 0x08,
+    0x10, 0x02, 0x02, 0x80, 0x68, 0x0a, 0x02, 0x80, 0x07, 0x14, 0x24, 0x80,
+    0x03, 0x41, 0x01, 0x00, 0x3c, 0x80, 0x02, 0x80, 0x04, 0x02, 0x18, 0x04,
+    0x01, 0x7c, 0x03, 0x01, 0x40, 0x04, 0x01, 0x05, 0x08, 0x42, 0x03, 0x20,
+    0x42, 0x01, 0x80, 0x38, 0x44, 0x40, 0x02, 0x03, 0x10, 0x04, 0x01, 0x02,
+    0x3c, 0x80, 0x04, 0x06, 0x20, 0x01, 0x02, 0x20, 0x02, 0x01, 0x30, 0x85,
+    0x04, 0x81, 0x04, 0x03, 0x40, 0x80, 0x3e, 0x80, 0x01, 0x40, 0x01, 0x01,
+    0x04, 0x01, 0x20, 0x01, 0x01, 0x1e, 0x80, 0x02, 0x07, 0x02, 0x01, 0x80,
+    0x01, 0x20, 0x02, 0x42, 0x2c, 0xc1, 0x40, 0x02, 0x08, 0x80, 0x08, 0x01,
+    0x80, 0x1a, 0x01, 0x01, 0x07, 0x04, 0x40, 0x80, 0x03, 0x40, 0x01, 0x12,
+    0x80, 0x04, 0x03, 0x02, 0x80, 0x08, 0x42, 0x02, 0x04, 0x1e, 0x80, 0x08,
+    0x40, 0x04, 0x01, 0x40, 0x01, 0x01, 0x1c, 0x80, 0x10, 0x02, 0x01, 0x01,
+    0x80, 0x1e, 0x01, 0x02, 0x02, 0x80, 0x02, 0x80, 0x40, 0x01, 0x01, 0x01,
+    0x01, 0x0b, 0x80, 0x03, 0xc0, 0x02, 0x10, 0x01, 0x80, 0x0d, 0x80, 0x04,
+    0x03, 0x80, 0x01, 0x01, 0x02, 0x8a, 0x40, 0x05, 0x01, 0x01, 0x80, 0x01,
+    0x07, 0x81, 0x02, 0x08, 0x80, 0x20, 0x40, 0x08, 0x00, 0xab, 0x80, 0x10,
+    0x41, 0x04, 0x08, 0x40, 0x05, 0x80, 0x01, 0x80, 0x02, 0x00, 0x4e, 0x80,
+    0x40, 0x80, 0x20, 0x40, 0x02, 0x80, 0x01, 0x41, 0x80, 0x20, 0x80, 0x02,
+    0x85, 0x01, 0x04, 0x41, 0x02, 0x01, 0xc0, 0x03, 0x04, 0x25, 0xc0, 0x04,
+    0x40, 0x01, 0x01, 0x80, 0x02, 0x93, 0x80, 0x80, 0x40, 0x11, 0x80, 0x01,
+    0x01, 0x04, 0xc1, 0x40, 0x0a, 0x80, 0x04, 0x40, 0x04, 0x80, 0x81, 0x0a,
+    0x08, 0x26, 0x01, 0x04, 0x40, 0x02, 0x80, 0x04, 0x8d, 0x40, 0x10, 0x40,
+    0x08, 0x80, 0x01, 0x61, 0x10, 0x06, 0x08, 0xc0, 0xc0, 0x02, 0x08, 0x02,
+    0x04, 0xc4, 0x40, 0x04, 0x40, 0x04, 0x82, 0x08, 0x10, 0x82, 0x41, 0x03,
+    0x02, 0x20, 0x08, 0xf4, 0x80, 0x21, 0x80, 0x02, 0x80, 0x08, 0x40, 0x08,
+    0x51, 0x20, 0x04, 0x10, 0xd1, 0x40, 0x20, 0x80, 0x08, 0x80, 0x10, 0x22,
+    0x10, 0x01, 0x89, 0x40, 0x02, 0x80, 0x02, 0x10, 0x08, 0xc2, 0x80, 0x01,
+    0x40, 0x11, 0xa4, 0x08, 0x10, 0x20, 0xe2, 0x40, 0x04, 0x80, 0x10, 0x20,
+    0x04, 0x1d, 0x40, 0x04, 0x0c, 0x02, 0xe4, 0x80, 0x02, 0x40, 0x0c, 0xa0,
+    0x08, 0x20, 0x52, 0x20, 0x10, 0x20, 0xa2, 0x40, 0x10, 0x80, 0x01, 0x04,
+    0x10, 0xd3, 0x81, 0x05, 0x01, 0x40, 0x08, 0x80, 0x10, 0x60, 0x10, 0x20,
+    0x28, 0x10, 0x20, 0xa9, 0x01, 0x02, 0x80, 0x10, 0xc0, 0x10, 0x20, 0x81,
+    0x80, 0x40, 0x43, 0x40, 0x04, 0x80, 0x02, 0x20, 0x02, 0xc8, 0x80, 0x04,
+    0xb1, 0x10, 0x08, 0x20, 0x40, 0x54, 0x20, 0x20, 0x40, 0xf4, 0x80, 0x04,
+    0x80, 0x20, 0x40, 0x22, 0x11, 0x08, 0x10, 0x03, 0x02, 0x40, 0xc0, 0x41,
+    0x20, 0x40, 0x08, 0x20, 0xb1, 0xc0, 0x08, 0x02, 0x40, 0x18, 0xa0, 0x18,
+    0x40, 0x24, 0x04, 0x40, 0xc3, 0x40, 0x20, 0x80, 0x04, 0x30, 0x24, 0x40,
+    0x80, 0x80, 0x7c, 0x80, 0x20, 0x80, 0x20, 0x80, 0x02, 0x60, 0x20, 0x40,
+    0x81, 0x40, 0x80, 0xd3, 0x40, 0x10, 0x80, 0x40, 0xc0, 0x20, 0x40, 0x48,
+    0x10, 0x80, 0x52, 0x04, 0x42, 0x80, 0xe4, 0x80, 0x08, 0xa0, 0x04, 0x80,
+    0x02, 0x10, 0x20, 0x01, 0xe1, 0x80, 0x04, 0x20, 0x40, 0x1a, 0x20, 0x20,
+    0x40, 0x08, 0x04, 0x72, 0x80, 0x08, 0x40, 0x40, 0x40, 0x80, 0x20, 0x80,
+    0xf8, 0x80, 0x40, 0xc0, 0x04, 0x80, 0x10, 0x30, 0x04, 0x30, 0x2d, 0x04,
+    0x40, 0x40, 0x80, 0x40, 0x01, 0x80, 0xf8, 0x40, 0x30, 0x20, 0x30, 0x20,
+    0x80, 0x0a, 0x40, 0x40, 0x06, 0x08, 0x08, 0x71, 0x80, 0x88, 0x40, 0x80,
+    0x10, 0x40, 0x11, 0x08, 0x80, 0x1e, 0x80, 0x10, 0x80, 0x40, 0xc0, 0x40,
+    0x80, 0x20, 0x40, 0xe0, 0x10, 0x08, 0x16, 0x10, 0x50, 0x04, 0x05, 0x08,
+    0x40, 0xb0, 0x20, 0x88, 0x10, 0x80, 0x18, 0x08, 0x04, 0xe9, 0x80, 0x10,
+    0x40, 0x80, 0x08, 0x20, 0x20, 0x02, 0x36, 0x10, 0x10, 0x80, 0x02, 0xa2,
+    0x80, 0x40, 0x08, 0x40, 0x42, 0x40, 0x01, 0xcc, 0x80, 0x80, 0x40, 0x08,
+    0x49, 0x10, 0x80, 0x01, 0x07, 0x90, 0x20, 0x20, 0x51, 0x80, 0x20, 0x10,
+    0x60, 0x02, 0x20, 0xcd, 0x80, 0x40, 0x40, 0x60, 0x20, 0x60, 0x02, 0x40,
+    0x09, 0x20, 0x10, 0xf8, 0xa0, 0x80, 0x04, 0x10, 0x80, 0x08, 0x80, 0x04,
+    0x20, 0x01, 0x40, 0xc4, 0x40, 0x80, 0x05, 0xa0, 0x40, 0x98, 0x40, 0x08,
+    0x01, 0xe2, 0x80, 0x80, 0x10, 0x08, 0x08, 0x10, 0x28, 0x20, 0x04, 0xf8,
+    0x20, 0x10, 0x10, 0x10, 0x80, 0x01, 0x01, 0x40, 0x40, 0x02, 0x40, 0x90,
+    0x08, 0x01, 0x60, 0x60, 0x04, 0x02, 0x60, 0x04, 0x02, 0x80, 0x90, 0x10,
+    0x02, 0x18, 0x10, 0xc0, 0x08, 0xc0, 0xd4, 0x60, 0xc0, 0x10, 0x80, 0x02,
+    0x08, 0x20, 0x60, 0x08, 0x04, 0x02, 0x40, 0x80, 0x6a, 0x40, 0x40, 0x80,
+    0x04, 0x08, 0x20, 0x80, 0x02, 0xe0, 0x80, 0x02, 0x18, 0xc0, 0x10, 0x90,
+    0x20, 0x04, 0x58, 0x10, 0x20, 0x10, 0x10, 0x60, 0x08, 0x04, 0xa4, 0x20,
+    0x20, 0x10, 0x10, 0x10, 0x80, 0xb1, 0x80, 0x80, 0x40, 0x04, 0x40, 0x04,
+    0x60, 0x10, 0x08, 0xf0, 0x20, 0x08, 0x20, 0x08, 0x80, 0x04, 0x10, 0x40,
+    0xe0, 0x08, 0x40, 0x10, 0x20, 0x80, 0x08, 0x64, 0x10, 0x80, 0x80, 0x04,
+    0x40, 0x08, 0x5a, 0x20, 0x80, 0x08, 0x80, 0x88, 0x40, 0x04, 0x20, 0x10,
+    0x40, 0x80, 0x08, 0xa2, 0x40, 0x20, 0x58, 0x80, 0x20, 0x08, 0x40, 0x10,
+    0xac, 0x10, 0x40, 0x40, 0x08, 0x20, 0x10, 0x20, 0x20, 0xf3, 0x40, 0x80,
+    0x20, 0x40, 0x40, 0x08, 0x80, 0x08, 0x10, 0x40, 0x80, 0x10, 0x58, 0x10,
+    0x20, 0x10, 0x20, 0x40, 0x10, 0x58, 0x20, 0x10, 0x20, 0x10, 0xa0, 0x20,
+    0x10, 0x19, 0x80, 0x40, 0x80, 0x08, 0x88, 0x80, 0x08, 0x20, 0x50, 0x40,
+    0x10, 0x68, 0x08, 0x80, 0xa0, 0x20, 0x10, 0x10, 0x80, 0x00, 0xd6, 0x10,
+    0x80, 0x40, 0x10, 0x40, 0x10, 0x40, 0x20, 0xc0, 0x20, 0x20, 0x58, 0x40,
+    0x10, 0xb0, 0x40, 0x20, 0x10, 0x80, 0x20, 0x64, 0x80, 0x10, 0x50, 0x80,
+    0x20, 0x20, 0x40, 0x29, 0x20, 0x80, 0x80, 0x10, 0x80, 0x20, 0x28, 0x30,
+    0x40, 0x20, 0x20, 0x40, 0x14, 0x30, 0x40, 0x20, 0x40, 0x20, 0x12, 0x40,
+    0x20, 0x80, 0x20, 0xd2, 0x80, 0x20, 0x30, 0x80, 0x40, 0x80, 0x40, 0x10,
+    0x80, 0x68, 0xc0, 0x20, 0x20, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x05, 0x80,
+    0x40, 0x40, 0x20, 0x1c, 0x80, 0x20, 0x30, 0x80, 0x40, 0x40, 0x40, 0x30,
+    0x80, 0x40, 0x20, 0x80, 0x00, 0x1d, 0x20, 0x01, 0x20, 0x40, 0xc0, 0x40,
+    0x40, 0x20, 0x80, 0x27, 0x10, 0x01, 0x20, 0x40, 0x10, 0x80, 0x80, 0x80,
+    0x36, 0x20, 0x01, 0xc0, 0x40, 0x40, 0x80, 0x80, 0x40, 0x80, 0x1b, 0x48,
+    0x01, 0x01, 0x90, 0x81, 0x40, 0x20, 0x80, 0x40, 0x80, 0x02, 0x40, 0x40,
+    0x08, 0xc0, 0x80, 0x80, 0x45, 0x04, 0x01, 0x20, 0x80, 0x80, 0x80, 0x06,
+    0x08, 0x01, 0x80, 0x80, 0x05, 0x30, 0x02, 0x02, 0x40, 0x80, 0x03, 0x80,
+    0x80, 0xa0, 0x80, 0x80, 0x03, 0x28, 0x02, 0x80, 0x40, 0x80, 0x01, 0x42,
+    0x01, 0x80, 0x00, 0x01, 0x80, 0x01, 0x00, 0x01, 0x04, 0x02, 0x01, 0x40,
+    0x02, 0x02, 0x04, 0x01, 0x80, 0x80, 0x40, 0x80, 0x20, 0x01, 0x80, 0x10,
+    0x01, 0x80, 0x40, 0x01, 0x01, 0x90, 0x04, 0x01, 0x80, 0x08, 0x01, 0xc0,
+    0x30, 0x01, 0x01, 0x20, 0x02, 0x40, 0x68, 0x01, 0x80, 0x80, 0x81, 0x40,
+    0x02, 0x70, 0x02, 0x40, 0x40, 0xe1, 0x08, 0x04, 0x10, 0x01, 0x04, 0x01,
+    0x04, 0x01, 0x60, 0x08, 0x01, 0x10, 0x02, 0xe0, 0x24, 0x01, 0x01, 0x60,
+    0x02, 0x01, 0x80, 0x80, 0xd0, 0x18, 0x01, 0x01, 0x0a, 0x01, 0x02, 0x08,
+    0x02, 0xe0, 0x02, 0x01, 0x01, 0x01, 0x12, 0x01, 0x80, 0x74, 0x18, 0x01,
+    0x01, 0x04, 0x01, 0x18, 0x02, 0x02, 0x04, 0x02, 0xb8, 0x18, 0x01, 0x01,
+    0x20, 0x01, 0x01, 0x01, 0x40, 0x80, 0xe3, 0x02, 0x01, 0x18, 0x02, 0x02,
+    0x24, 0x02, 0x02, 0x10, 0x04, 0x20, 0x80, 0x78, 0x04, 0x01, 0x1a, 0x01,
+    0x02, 0x02, 0x40, 0x01, 0x02, 0x02, 0xf0, 0x04, 0x02, 0x02, 0x02, 0x28,
+    0x04, 0x04, 0x04, 0x02, 0xfc, 0x04, 0x01, 0x28, 0x02, 0x01, 0x01, 0x01,
+    0x19, 0x02, 0x04, 0x04, 0x01, 0x02, 0x40, 0x01, 0x78, 0x10, 0x02, 0x22,
+    0x02, 0x02, 0x04, 0x04, 0x40, 0x02, 0x7c, 0x08, 0x02, 0x06, 0x01, 0x02,
+    0x08, 0x04, 0x20, 0x04, 0x04, 0x04, 0x55, 0x40, 0x01, 0x30, 0x02, 0x01,
+    0x15, 0x02, 0x04, 0x04, 0x40, 0x02, 0x3c, 0x04, 0x02, 0x02, 0x02, 0x40,
+    0x01, 0x42, 0x04, 0x02, 0x9a, 0x04, 0x02, 0x28, 0x04, 0x02, 0x02, 0x04,
+    0x20, 0x02, 0x38, 0x15, 0x01, 0x04, 0x04, 0x20, 0x04, 0x19, 0x04, 0x08,
+    0x08, 0xfc, 0x08, 0x04, 0x01, 0x02, 0x09, 0x04, 0x08, 0x04, 0x08, 0x02,
+    0x04, 0x20, 0x01, 0x5f, 0x04, 0x04, 0x08, 0x04, 0x36, 0x03, 0x04, 0x04,
+    0x02, 0x02, 0x04, 0x14, 0x08, 0x08, 0x40, 0x01, 0x18, 0x08, 0x08, 0x40,
+    0x02, 0x3a, 0x14, 0x04, 0x04, 0x65, 0x04, 0x08, 0x04, 0x01, 0x02, 0x08,
+    0x02, 0x08, 0xce, 0x20, 0x02, 0x02, 0x04, 0x10, 0x08, 0x08, 0x08, 0x12,
+    0x01, 0x02, 0xdc, 0x0c, 0x08, 0x08, 0x02, 0x08, 0x21, 0x08, 0x08, 0x20,
+    0x04, 0x04, 0x02, 0x94, 0x20, 0x04, 0x0c, 0x10, 0x10, 0x10, 0x01, 0xaf,
+    0x08, 0x08, 0x0a, 0x02, 0x08, 0x11, 0x02, 0x08, 0x49, 0x08, 0x10, 0x02,
+    0x21, 0x08, 0x08, 0x08, 0x02, 0x3e, 0x06, 0x04, 0x08, 0x03, 0x04, 0x08,
+    0x24, 0x10, 0x08, 0x10, 0x10, 0x48, 0x10, 0x02, 0xfb, 0x04, 0x08, 0x10,
+    0x08, 0x12, 0x10, 0x10, 0x02, 0x10, 0x44, 0x10, 0x01, 0x20, 0x02, 0x0c,
+    0x01, 0x01, 0x67, 0x10, 0x08, 0x20, 0x04, 0x0d, 0x08, 0x10, 0x10, 0x20,
+    0x08, 0x20, 0x01, 0x1e, 0x02, 0x08, 0x01, 0x01, 0x01, 0x10, 0x41, 0x10,
+    0x04, 0x4e, 0x0a, 0x01, 0x10, 0x72, 0x10, 0x10, 0x08, 0x01, 0x40, 0x04,
+    0x08, 0x08, 0x0f, 0x22, 0x04, 0x04, 0x04, 0x10, 0x40, 0x02, 0x0c, 0x20,
+    0x20, 0x57, 0x08, 0x10, 0x01, 0x04, 0x01, 0x10, 0x0c, 0x20, 0x20, 0x01,
+    0x01, 0x7f, 0x26, 0x08, 0x10, 0x01, 0x33, 0x08, 0x10, 0x10, 0x08, 0x0c,
+    0x20, 0x20, 0x02, 0x20, 0x40, 0x04, 0x02, 0x10, 0x10, 0x04, 0x4c, 0x42,
+    0x20, 0x04, 0x30, 0x20, 0x10, 0x11, 0x02, 0x01, 0x5a, 0x04, 0x20, 0x01,
+    0x20, 0x42, 0x20, 0x01, 0x10, 0x02, 0x37, 0x12, 0x10, 0x10, 0x09, 0x12,
+    0x20, 0x31, 0x20, 0x20, 0x10, 0x40, 0x02, 0x20, 0x04, 0x63, 0x22, 0x02,
+    0x08, 0x02, 0x20, 0x20, 0x03, 0x02, 0x01, 0x0d, 0x0c, 0x20, 0x20, 0x04,
+    0x40, 0x04, 0x40, 0x5e, 0x71, 0x20, 0x20, 0x10, 0x02, 0x0a, 0x40, 0x40,
+    0x0a, 0x40, 0x40, 0x01, 0x20, 0x0a, 0x04, 0x05, 0x47, 0x03, 0x08, 0x20,
+    0x44, 0x40, 0x04, 0x40, 0x08, 0x0e, 0x02, 0x01, 0x02, 0x27, 0x01, 0x10,
+    0x0a, 0x40, 0x40, 0x01, 0x40, 0x01, 0x01, 0x09, 0x10, 0x20, 0x01, 0x40,
+    0x6f, 0x24, 0x40, 0x10, 0x41, 0x40, 0x08, 0x10, 0x40, 0x40, 0x01, 0x10,
+    0x09, 0x04, 0x06, 0x05, 0x0b, 0x24, 0x40, 0x40, 0x24, 0x80, 0x20, 0x3e,
+    0x34, 0x80, 0x40, 0x20, 0x02, 0x80, 0x40, 0x02, 0x20, 0x01, 0x11, 0x02,
+    0x06, 0x3e, 0x02, 0x80, 0x08, 0x80, 0x40, 0x04, 0x20, 0x0a, 0x0a, 0x01,
+    0x10, 0x17, 0x05, 0x40, 0x80, 0x08, 0x80, 0x01, 0x80, 0x21, 0x01, 0x04,
+};
+constexpr BakedFrames bakedPlasma = {bakedPlasmaData, 2389, 43};
+#else
+#define BAKED_BYTES_3 BAKED_BYTES_2
+#endif
+
+#if BAKED_FLASH_BUDGET >= BAKED_BYTES_3 + 5651
+#define BAKED_SINE_WAVE
+#define BAKED_BYTES_4 (BAKED_BYTES_3 + 5651)
+static const uint8_t bakedSineWaveData[] PROGMEM = {
+    0x00, 0xdb, 0xf0, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0xfd, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff, 0x02, 0x81,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x84, 0x42, 0x21, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x7f, 0x78, 0x3c, 0x1e, 0x0f, 0x07, 0x03, 0x01, 0x7e,
+    0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x01, 0x01, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff,
+    0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x07, 0x04, 0x02, 0x01,
+    0xdb, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xff,
+    0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff, 0x02, 0x01, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x0f, 0x08, 0x04, 0x02, 0x01, 0x0f, 0x08,
+    0x04, 0x02, 0x01, 0xfe, 0x01, 0x01, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0x07, 0x04, 0x02, 0x01, 0xff,
+    0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x80, 0xc0, 0x60,
+    0x30, 0x18, 0x0c, 0x06, 0x03, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0xff, 0xe0, 0x80, 0x40, 0x20, 0xf0, 0x80, 0xc0, 0x60, 0x30,
+    0xf3, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x03, 0x02, 0x01, 0xfc, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0xff, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10,
+    0x08, 0x04, 0x1f, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x1f, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0xdb, 0x01, 0x01, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0xff, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x7e, 0x03, 0x02, 0x01, 0xf3, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0x0f, 0x08, 0x04,
+    0x02, 0x01, 0xff, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0xfc,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff, 0xc0, 0x80, 0x40, 0xe0, 0x80,
+    0xc0, 0x60, 0xe7, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0xf7, 0x04, 0x02,
+    0x01, 0x80, 0x40, 0x20, 0x10, 0xf8, 0x80, 0xc0, 0x60, 0x30, 0x18, 0xff,
+    0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x3f, 0x30, 0x18, 0x0c,
+    0x06, 0x03, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x03,
+    0x02, 0x01, 0x07, 0x06, 0x03, 0x01, 0xe7, 0x04, 0x02, 0x01, 0x80, 0x40,
+    0x20, 0xef, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x1f, 0x18, 0x0c,
+    0x06, 0x03, 0x01, 0xff, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08,
+    0xfc, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0xfc, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x7e, 0xc0, 0x80, 0x40, 0xcf, 0x08, 0x04, 0x02, 0x01, 0x80,
+    0x40, 0x0f, 0x08, 0x04, 0x02, 0x01, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xff,
+    0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x3f, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xdb, 0x80, 0x80, 0x80, 0x80, 0xff, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x80, 0x40, 0x20, 0xff, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80,
+    0x40, 0x20, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x07, 0x04, 0x02, 0x01, 0x0f,
+    0x0c, 0x06, 0x03, 0x01, 0xcf, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0xc0,
+    0x80, 0x40, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x20, 0x10,
+    0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0xf8, 0x80, 0xc0, 0x60, 0x30, 0x18,
+    0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xfe, 0x80, 0x80, 0x9f, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x80, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0xe0, 0x80,
+    0x40, 0x20, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0xff,
+    0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0xdb, 0x0f, 0x08, 0x04, 0x02, 0x01, 0x0f,
+    0x08, 0x04, 0x02, 0x01, 0xff, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80,
+    0x40, 0xff, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0xf0, 0x80,
+    0x40, 0x20, 0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0x7e, 0x1f, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x9f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x80, 0x80,
+    0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x82, 0x41, 0x20, 0xe0, 0x80, 0x40, 0x20, 0xff, 0x01, 0x01,
+    0x01, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xbf, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0x80, 0xc0, 0x80, 0xc0, 0xff, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x82, 0x41, 0xff, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c,
+    0x06, 0x03, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x1f,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01,
+    0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0xe0, 0x80, 0xc0,
+    0x60, 0xe0, 0x80, 0x40, 0x20, 0x7e, 0x01, 0x01, 0x7f, 0x41, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x80, 0x80, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0xfe, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xdb, 0x03, 0x02, 0x01, 0x03, 0x02,
+    0x01, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xfc, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff, 0x3f, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03,
+    0x01, 0x7f, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01, 0xfe,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x82, 0xc0, 0x80, 0xc0, 0xc0, 0x80, 0x40, 0xef, 0x07, 0x04,
+    0x02, 0x01, 0x07, 0x06, 0x03, 0x01, 0xff, 0x82, 0x41, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0xc0, 0x60, 0x30,
+    0x18, 0x0c, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xdb, 0x7f, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0xff, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x01,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x80, 0x80, 0x80, 0x80, 0x3e,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x82, 0x41,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0xfc, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff,
+    0x0f, 0x08, 0x04, 0x02, 0x01, 0x0f, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x04,
+    0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x02, 0x81, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x03, 0x03, 0x01, 0xf9, 0x01, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0xf8, 0x80, 0xc0, 0x60, 0x30, 0x18, 0xf0, 0x80, 0x40, 0x20,
+    0x10, 0x7f, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff,
+    0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0xff, 0x04, 0x82, 0x41,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0xfc, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0xf9, 0x01, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x01, 0x01, 0x7e, 0x0f, 0x08, 0x04, 0x02, 0x01,
+    0xff, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x03, 0x02, 0x01, 0xf3, 0x02, 0x01, 0x80, 0x40,
+    0x20, 0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xdb, 0x1f, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0xe0, 0x80, 0x40, 0x20, 0xe0, 0x80, 0x40, 0x20, 0xff, 0xfe,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0xc0, 0x60, 0x30,
+    0x18, 0x0c, 0x06, 0xff, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04,
+    0x0f, 0x08, 0x04, 0x02, 0x01, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xf3, 0x02,
+    0x01, 0x80, 0x40, 0x20, 0x10, 0x03, 0x03, 0x01, 0x01, 0x01, 0xff, 0x3f,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x30, 0x18, 0x0c, 0x06, 0x03,
+    0x01, 0xff, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0xf8, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x07, 0x04, 0x02, 0x01, 0xe7, 0x04, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0xe0, 0x80, 0xc0, 0x60, 0xc0, 0x80, 0x40, 0xdb, 0xfc,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0xff, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0xff, 0x08,
+    0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x03, 0x02, 0x01, 0x03, 0x02,
+    0x01, 0x7e, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x10, 0x08, 0x04,
+    0x82, 0x41, 0x20, 0x10, 0x08, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0xe0,
+    0x80, 0x40, 0x20, 0xe7, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x07, 0x04,
+    0x02, 0x01, 0xff, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f,
+    0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x20, 0x10, 0x08, 0x04,
+    0x82, 0x41, 0x20, 0x10, 0xff, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20,
+    0x10, 0x1f, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xcf, 0x08, 0x04, 0x02, 0x01,
+    0x80, 0x40, 0xc0, 0x80, 0xc0, 0x80, 0x80, 0xff, 0xf8, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0xf8, 0x80, 0xc0, 0x60, 0x30, 0x18, 0xff, 0x20, 0x10, 0x08,
+    0x04, 0x82, 0x41, 0x20, 0x10, 0xff, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81,
+    0x40, 0x20, 0xe0, 0x80, 0xc0, 0x60, 0xcf, 0x08, 0x04, 0x02, 0x01, 0x80,
+    0x40, 0x0f, 0x0c, 0x06, 0x03, 0x01, 0x07, 0x04, 0x02, 0x01, 0x7e, 0x7f,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x82, 0x41, 0x20, 0xe0, 0x80, 0x40, 0x20, 0x1f, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x9f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x80, 0x80, 0x1b,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x80, 0x40, 0xff, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40,
+    0xff, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xf0, 0x80, 0xc0, 0x60, 0x30, 0xff,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x7f, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0x80, 0x80, 0x9f, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x80, 0x1f, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x0f, 0x08, 0x04, 0x02, 0x01,
+    0xff, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x80, 0xc0,
+    0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x82, 0x41, 0xc0, 0x80, 0x40, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xdb, 0xe0, 0x80, 0x40, 0x20, 0xe0, 0x80, 0x40, 0x20, 0xff, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x80, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x6e, 0xc0, 0x80, 0x40, 0xff, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x82, 0x41, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfe,
+    0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0xfe, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x82, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81,
+    0xff, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x7f, 0x41, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0xff,
+    0xc0, 0x80, 0x40, 0xc0, 0x80, 0xc0, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x82, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01,
+    0x7f, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x60, 0x30, 0x18,
+    0x0c, 0x06, 0x03, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x76,
+    0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff,
+    0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0xdb,
+    0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0xff, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x01, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x07, 0x04, 0x02, 0x01, 0x07, 0x04,
+    0x02, 0x01, 0xff, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x03, 0x02, 0x01,
+    0xff, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0xc0, 0x60,
+    0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0xff, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xf8, 0x80, 0xc0, 0x60,
+    0x30, 0x18, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x01, 0x01, 0xfe,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x04, 0x82, 0x41, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x0f, 0x0c, 0x06, 0x03, 0x01, 0x0f, 0x08, 0x04,
+    0x02, 0x01, 0xd8, 0xff, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0xff, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x7e, 0x01, 0x01, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0x07, 0x04, 0x02, 0x01, 0xff,
+    0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0xff, 0xe0, 0x80, 0x40, 0x20, 0xf0, 0x80, 0xc0,
+    0x60, 0x30, 0xf3, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0xfb, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0xfc, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c,
+    0xff, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x1f, 0x18, 0x0c,
+    0x06, 0x03, 0x01, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x01, 0x01,
+    0x03, 0x03, 0x01, 0xf3, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0xf7, 0x04,
+    0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x0f, 0x0c, 0x06, 0x03, 0x01, 0xff,
+    0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0xfe, 0x80, 0xc0, 0x60,
+    0x30, 0x18, 0x0c, 0x06, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x7e, 0xe0, 0x80, 0x40, 0x20, 0xe7, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20,
+    0x07, 0x04, 0x02, 0x01, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x10,
+    0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x1f, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0xdb, 0xc0, 0x80, 0x40, 0xc0, 0x80, 0x40, 0xff, 0x08, 0x04, 0x02,
+    0x01, 0x80, 0x40, 0x20, 0x10, 0xff, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40,
+    0x20, 0x10, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0xff, 0x03, 0x02, 0x01, 0x07, 0x06, 0x03, 0x01,
+    0xe7, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0xe0, 0x80, 0x40, 0x20, 0x1f,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20,
+    0x10, 0x08, 0xfc, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0xfc, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0xff, 0x80, 0x80, 0xc0, 0x80, 0xc0, 0xcf, 0x08,
+    0x04, 0x02, 0x01, 0x80, 0x40, 0x0f, 0x08, 0x04, 0x02, 0x01, 0xf0, 0x80,
+    0x40, 0x20, 0x10, 0xff, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10,
+    0x7f, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x7f, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0xdb, 0x07, 0x04, 0x02, 0x01, 0x07, 0x04, 0x02,
+    0x01, 0xff, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0xff, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0xf8, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0x7e, 0x0f, 0x08, 0x04, 0x02,
+    0x01, 0xcf, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0xc0, 0x80, 0x40, 0x3f,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x20, 0x10, 0x08, 0x04, 0x82,
+    0x41, 0x20, 0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xfe, 0x80, 0x80, 0x9f,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0xdf, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x80, 0x40, 0xe0, 0x80, 0xc0, 0x60, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x82, 0x41, 0x20, 0xff, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x0f, 0x08,
+    0x04, 0x02, 0x01, 0x1f, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x9f, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x80, 0xbf, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80,
+    0x7f, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x82, 0x41, 0x20, 0xf0, 0x80, 0xc0, 0x60, 0x30, 0xf0, 0x80,
+    0x40, 0x20, 0x10, 0x7c, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xc0, 0x80, 0x40, 0xff, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xdb, 0x01, 0x01, 0x01, 0x01, 0xff, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0x80, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x80, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xf7, 0x1f, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x3f, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x3f, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0xe0, 0x80, 0xc0,
+    0x60, 0xe0, 0x80, 0x40, 0x20, 0xff, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01,
+    0x7f, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x82, 0xfe, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0xfc, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0xdb, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0xc0, 0x80, 0x40, 0xc0, 0x80, 0x40, 0x7e, 0x7f, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x01, 0x01, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x80, 0x80, 0xff, 0x07, 0x04,
+    0x02, 0x01, 0x07, 0x06, 0x03, 0x01, 0xff, 0x82, 0x41, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x01, 0x01, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0xc0,
+    0x60, 0x30, 0x18, 0x0c, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x7f,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0xc0, 0x60, 0x30, 0x18,
+    0x0c, 0x06, 0x03, 0x01, 0xff, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0xff, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80,
+    0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x07, 0x04, 0x02, 0x01, 0xff, 0x04,
+    0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0x01, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xdb, 0x0f, 0x08, 0x04, 0x02, 0x01,
+    0x0f, 0x08, 0x04, 0x02, 0x01, 0xff, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0xff, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xf0,
+    0x80, 0x40, 0x20, 0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0x7f, 0xff, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0xc0, 0x60, 0x30,
+    0x18, 0x0c, 0x06, 0x03, 0xff, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x07, 0x04, 0x02, 0x01, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xf9,
+    0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x01, 0x01, 0xff, 0x1f, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x1f, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x08, 0x04,
+    0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x03, 0x02, 0x01, 0xf3, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0xf0,
+    0x80, 0xc0, 0x60, 0x30, 0xe0, 0x80, 0x40, 0x20, 0xdb, 0xfe, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0xff, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x04,
+    0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x01, 0x01, 0x01, 0x01, 0x7e,
+    0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff, 0x08, 0x04, 0x82, 0x41,
+    0x20, 0x10, 0x08, 0x04, 0x0f, 0x08, 0x04, 0x02, 0x01, 0xf0, 0x80, 0x40,
+    0x20, 0x10, 0xf3, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x03, 0x02, 0x01,
+    0xff, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x30, 0x18, 0x0c,
+    0x06, 0x03, 0x01, 0xff, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08,
+    0xff, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x0f, 0x0c, 0x06,
+    0x03, 0x01, 0xe7, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0xe0, 0x80, 0xc0,
+    0x60, 0xc0, 0x80, 0x40, 0xff, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0xfc, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0xff, 0x10, 0x08, 0x04, 0x82,
+    0x41, 0x20, 0x10, 0x08, 0xff, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20,
+    0x10, 0xf0, 0x80, 0xc0, 0x60, 0x30, 0xe7, 0x04, 0x02, 0x01, 0x80, 0x40,
+    0x20, 0x07, 0x06, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x3f, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0xff, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20,
+    0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0x0f, 0x08, 0x04, 0x02, 0x01, 0xcf,
+    0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0xc0, 0x80, 0x40, 0xdb, 0x7f, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0xff, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0xff,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x80, 0x80, 0x80, 0x80,
+    0xff, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xf8, 0x80, 0xc0, 0x60, 0x30,
+    0x18, 0xff, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x3f, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0xc0, 0x80, 0x40, 0xcf, 0x08, 0x04, 0x02,
+    0x01, 0x80, 0x40, 0x0f, 0x0c, 0x06, 0x03, 0x01, 0x07, 0x04, 0x02, 0x01,
+    0x7f, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0xc0,
+    0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x82, 0x41, 0x20, 0xe0, 0x80, 0x40, 0x20, 0x1f, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x9f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x80, 0x80, 0xdb,
+    0xf0, 0x80, 0x40, 0x20, 0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xff, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0xff, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x80, 0x40, 0x0f, 0x08, 0x04, 0x02, 0x01, 0x0f, 0x08, 0x04,
+    0x02, 0x01, 0x7e, 0xe0, 0x80, 0x40, 0x20, 0xff, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x82, 0x41, 0x20, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x80, 0x80, 0x9f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x1f, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0xff, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0xff, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x81, 0x40, 0x7f, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x3f,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xe0,
+    0x80, 0x40, 0x20, 0xe0, 0x80, 0xc0, 0x60, 0xff, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x82, 0x41, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x81, 0x80, 0x80, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x30,
+    0x18, 0x0c, 0x06, 0x03, 0x01, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7e,
+    0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x82, 0x80, 0x80, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x7f, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01,
+    0xdb, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01,
+    0x03, 0x02, 0x01, 0xff, 0xc0, 0x80, 0x40, 0xc0, 0x80, 0xc0, 0xfe, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x01, 0x7f, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x7f, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x3f, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xf7, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xfc, 0x80,
+    0xc0, 0x60, 0x30, 0x18, 0x0c, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x82, 0x41,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x07, 0x06, 0x03, 0x01, 0x07, 0x04,
+    0x02, 0x01, 0xdb, 0x80, 0x80, 0x80, 0x80, 0xff, 0x01, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0xff, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x7c, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x03, 0x02, 0x01, 0xff,
+    0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xf8,
+    0x80, 0xc0, 0x60, 0x30, 0x18, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0xfd, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfe, 0x80, 0xc0, 0x60,
+    0x30, 0x18, 0x0c, 0x06, 0xff, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x0f, 0x0c, 0x06, 0x03, 0x01, 0x0f, 0x08, 0x04, 0x02, 0x01, 0xfe,
+    0x01, 0x01, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0xfb, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x07, 0x06, 0x03, 0x01, 0xff, 0x04, 0x82,
+    0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x80, 0xc0, 0x60, 0x30, 0x18,
+    0x0c, 0x06, 0x03, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x7e, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xf3, 0x02, 0x01, 0x80, 0x40, 0x20,
+    0x10, 0x03, 0x02, 0x01, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff,
+    0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x0f, 0x08, 0x04, 0x02,
+    0x01, 0xdb, 0xe0, 0x80, 0x40, 0x20, 0xe0, 0x80, 0x40, 0x20, 0xff, 0x04,
+    0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x04, 0x02, 0x01, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0xff, 0x01, 0x01, 0x03, 0x03, 0x01, 0xf3, 0x02,
+    0x01, 0x80, 0x40, 0x20, 0x10, 0xf0, 0x80, 0x40, 0x20, 0x10, 0x0f, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04,
+    0xfe, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0xfe, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0xff, 0xc0, 0x80, 0x40, 0xe0, 0x80, 0xc0, 0x60,
+    0xe7, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x07, 0x04, 0x02, 0x01, 0xf8,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20,
+    0x10, 0x08, 0x3f, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x3f, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0xdb, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0xff,
+    0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0xff, 0x08, 0x04, 0x02,
+    0x01, 0x80, 0x40, 0x20, 0x10, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x7e, 0x07, 0x04, 0x02, 0x01,
+    0xe7, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0xe0, 0x80, 0x40, 0x20, 0x1f,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20,
+    0x10, 0x08, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x80, 0x80, 0xc0,
+    0x80, 0xc0, 0xcf, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0xef, 0x08, 0x04,
+    0x02, 0x01, 0x80, 0x40, 0x20, 0xf0, 0x80, 0xc0, 0x60, 0x30, 0xff, 0x20,
+    0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x7f, 0x60, 0x30, 0x18, 0x0c,
+    0x06, 0x03, 0x01, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff,
+    0x07, 0x04, 0x02, 0x01, 0x0f, 0x0c, 0x06, 0x03, 0x01, 0xcf, 0x08, 0x04,
+    0x02, 0x01, 0x80, 0x40, 0xdf, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40,
+    0x3f, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x20, 0x10, 0x08, 0x04,
+    0x82, 0x41, 0x20, 0x10, 0xf8, 0x80, 0xc0, 0x60, 0x30, 0x18, 0xf8, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x7e, 0x80, 0x80, 0x9f, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x80, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0xe0, 0x80, 0x40, 0x20,
+    0xff, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x7f, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0xd8, 0xff, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x80, 0x40, 0xff, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x0f, 0x08, 0x04, 0x02, 0x01,
+    0x1f, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x9f, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x80, 0x80, 0x80, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0xf0, 0x80, 0xc0, 0x60,
+    0x30, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xff, 0x01, 0x01, 0x01, 0x01, 0x3f,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0xc0, 0x80, 0x40, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82,
+    0x41, 0xff, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0xfe, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xdb, 0x1f, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x80, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x80, 0xe0, 0x80, 0x40, 0x20, 0xe0, 0x80, 0x40, 0x20, 0x76, 0x3f, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0xc0, 0x80, 0x40, 0xff, 0x03, 0x02,
+    0x01, 0x03, 0x03, 0x01, 0x7f, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x80, 0xfe, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0xfe, 0x80, 0xc0, 0x60, 0x30, 0x18,
+    0x0c, 0x06, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xff, 0x3f, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03,
+    0x01, 0x7f, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x81, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0xc0, 0x60, 0x30, 0x18,
+    0x0c, 0x06, 0x03, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0xc0,
+    0x80, 0xc0, 0xc0, 0x80, 0x40, 0x6e, 0x03, 0x02, 0x01, 0xff, 0x82, 0x41,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0xdb, 0x07, 0x04, 0x02, 0x01, 0x07, 0x04,
+    0x02, 0x01, 0xff, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff,
+    0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xf8, 0x80, 0x40, 0x20,
+    0x10, 0x08, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xff, 0x7f, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06,
+    0x03, 0x01, 0xff, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x03,
+    0x02, 0x01, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x80, 0x80, 0x80, 0x80, 0xff, 0x0f, 0x08, 0x04,
+    0x02, 0x01, 0x0f, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x04, 0x82, 0x41, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x01, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0xf8, 0x80, 0xc0,
+    0x60, 0x30, 0x18, 0xf0, 0x80, 0x40, 0x20, 0x10, 0x1b, 0xff, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0xff, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x7e, 0xfe, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x04, 0x82, 0x41, 0x20, 0x10,
+    0x08, 0x04, 0x02, 0x07, 0x04, 0x02, 0x01, 0xf8, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0xf9, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x01, 0x01, 0xff, 0x1f,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xff,
+    0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04, 0xff, 0x04, 0x02, 0x81,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x07, 0x06, 0x03, 0x01, 0xf3, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0x10, 0xf0, 0x80, 0xc0, 0x60, 0x30, 0xe0, 0x80, 0x40,
+    0x20, 0xff, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80,
+    0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0xff, 0x08, 0x04, 0x82, 0x41, 0x20,
+    0x10, 0x08, 0x04, 0xff, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08,
+    0xf8, 0x80, 0xc0, 0x60, 0x30, 0x18, 0xf3, 0x02, 0x01, 0x80, 0x40, 0x20,
+    0x10, 0x03, 0x03, 0x01, 0x01, 0x01, 0x7e, 0x1f, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0xff, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0xf8, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x07, 0x04, 0x02, 0x01, 0xe7, 0x04, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0xe0, 0x80, 0x40, 0x20, 0xdb, 0x3f, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x08,
+    0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0xff, 0x08, 0x04, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0x10, 0xc0, 0x80, 0x40, 0xc0, 0x80, 0x40, 0xff, 0xfc,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfc, 0x80, 0xc0, 0x60, 0x30, 0x18,
+    0x0c, 0xff, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10, 0x08, 0x1f, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0xe0, 0x80, 0x40, 0x20, 0xe7, 0x04, 0x02, 0x01,
+    0x80, 0x40, 0x20, 0x07, 0x06, 0x03, 0x01, 0x03, 0x02, 0x01, 0xff, 0x7f,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x60, 0x30, 0x18, 0x0c,
+    0x06, 0x03, 0x01, 0xff, 0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0x10,
+    0xf0, 0x80, 0x40, 0x20, 0x10, 0x0f, 0x08, 0x04, 0x02, 0x01, 0xcf, 0x08,
+    0x04, 0x02, 0x01, 0x80, 0x40, 0xc0, 0x80, 0xc0, 0x80, 0x80, 0xdb, 0xf8,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xff,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0xff, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x80, 0x40, 0x20, 0x07, 0x04, 0x02, 0x01, 0x07, 0x04, 0x02,
+    0x01, 0x7e, 0xf0, 0x80, 0x40, 0x20, 0x10, 0xff, 0x20, 0x10, 0x08, 0x04,
+    0x82, 0x41, 0x20, 0x10, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xc0,
+    0x80, 0x40, 0xcf, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x0f, 0x08, 0x04,
+    0x02, 0x01, 0x7f, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0xff, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0xff, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x82, 0x41, 0x20, 0xff, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x81, 0x40, 0x20, 0x3f, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x9f, 0x10,
+    0x08, 0x04, 0x02, 0x01, 0x80, 0x80, 0x80, 0xff, 0xf0, 0x80, 0x40, 0x20,
+    0x10, 0xf0, 0x80, 0xc0, 0x60, 0x30, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x82, 0x41, 0x20, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40,
+    0xc0, 0x80, 0xc0, 0x9f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x1f, 0x18,
+    0x0c, 0x06, 0x03, 0x01, 0x0f, 0x08, 0x04, 0x02, 0x01, 0x3e, 0xff, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20, 0x10,
+    0x08, 0x04, 0x82, 0x41, 0xc0, 0x80, 0x40, 0x3f, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xdb, 0xfe, 0x80,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0xff,
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x01, 0x01, 0x01, 0x01,
+    0xef, 0xe0, 0x80, 0x40, 0x20, 0xe0, 0x80, 0xc0, 0x60, 0xff, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x04, 0x82, 0x41, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x30,
+    0x18, 0x0c, 0x06, 0x03, 0x01, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff,
+    0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfe, 0x80, 0xc0, 0x60, 0x30,
+    0x18, 0x0c, 0x06, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x82, 0x80,
+    0x80, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x41, 0x20,
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0xdb,
+    0xc0, 0x80, 0x40, 0xc0, 0x80, 0x40, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    0x3f, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x7e, 0x80, 0x80, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0x82, 0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x7f,
+    0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x7f, 0x40, 0x20, 0x10, 0x08,
+    0x04, 0x02, 0x01, 0xff, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x08, 0xfc, 0x80,
+    0xc0, 0x60, 0x30, 0x18, 0x0c, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04,
+    0xfe, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x80, 0xc0, 0x60,
+    0x30, 0x18, 0x0c, 0x06, 0x03, 0xff, 0x82, 0x41, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x01, 0x07, 0x06, 0x03, 0x01, 0x07, 0x04, 0x02, 0x01, 0xff, 0x80,
+    0x80, 0x80, 0x80, 0xfc, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfd, 0x01,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x03, 0x03, 0x01, 0xff, 0x82, 0x41,
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xff, 0xc0, 0x60, 0x30, 0x18, 0x0c,
+    0x06, 0x03, 0x01, 0x7f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+};
+constexpr BakedFrames bakedSineWave = {bakedSineWaveData, 5602, 47};
+#else
+#define BAKED_BYTES_4 BAKED_BYTES_3
+#endif
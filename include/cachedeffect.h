@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "ieffect.h"
+
+// Flash the baked frame tables may take in total, see include/baked.h. The effects that don't fit are
+// computed live, 0 turns the tables off.
+#ifndef BAKED_FLASH_BUDGET
+#ifdef __AVR__
+// An eighth of the Uno flash.
+#define BAKED_FLASH_BUDGET 4096
+#else
+#define BAKED_FLASH_BUDGET 65536
+#endif
+#endif
+
+// BakedFrames is the precomputed run of an effect without randomness, generated by `ledcube bake`:
+// the frame after init then after each step, a lead in followed by a cycle repeating forever.
+//
+// Records are in flash, one per frame, each the xor with the previous frame: a byte with a bit per
+// changed layer, then for each of them a byte with a bit per changed row followed by the xor of these
+// rows. The record after the last frame goes back to the first frame of the cycle.
+struct BakedFrames {
+    const uint8_t* data;
+    // Offset of the record going back to the cycle.
+    uint16_t wrap;
+    // Offset of the record to apply after it.
+    uint16_t loop;
+};
+
+// CachedEffect replays baked frames in place of the effect, a step being one record and a frame copy.
+// The tables are constexpr, passed by value so that only the active effect holds its offsets in RAM.
+class CachedEffect : public BaseEffect {
+   public:
+    CachedEffect(BakedFrames baked, unsigned int speed) : BaseEffect(speed), _baked(baked) {}
+
+    void init(ICube& cube) {
+        this->_frame.clear();
+        this->_next = 0;
+        this->apply(cube);
+    }
+
+    void step(ICube& cube) {
+        this->apply(cube);
+    }
+
+   private:
+    void apply(ICube& cube) {
+        const uint8_t* p = this->_baked.data + this->_next;
+        const uint8_t layers = pgm_read_byte(p++);
+        for (uint8_t z = 0; z < 8; z++) {
+            if (!(layers >> z & 1)) {
+                continue;
+            }
+            const uint8_t rows = pgm_read_byte(p++);
+            for (uint8_t x = 0; x < 8; x++) {
+                if (rows >> x & 1) {
+                    this->_frame.rows[z][x] ^= pgm_read_byte(p++);
+                }
+            }
+        }
+        this->_next = this->_next == this->_baked.wrap ? this->_baked.loop : p - this->_baked.data;
+        cube.write(this->_frame);
+    }
+
+   private:
+    const BakedFrames _baked;
+    uint16_t _next = 0;
+    Frame _frame;
+};
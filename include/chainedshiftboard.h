@@ -0,0 +1,62 @@
+#pragma once
+
+#include "ishiftboard.h"
+#include "wiring.h"
+
+// ChainedShiftBoard drives Segments cubes daisy chained on the same clock, latch and data lines.
+// Each layer is a single latch cycle shifting, for each segment, its layer select byte followed by its 8 row bytes,
+// so the shift out is linear in the number of chained bytes.
+// Segment 0 is the first one on the data line: its bytes are shifted last.
+// Transport is the concrete shift register board, e.g. ShiftPulseBoard or SPIBoard.
+// The per voxel mapping is ignored, use the per segment wiring instead.
+template <uint8_t Segments, typename Transport>
+class ChainedShiftBoard : public Transport {
+   public:
+    // Inherit the transport constructor.
+    using Transport::Transport;
+
+    // Wiring of the given segment, straight by default.
+    // Wirings are usually constants and are kept by pointer.
+    void setWiring(uint8_t segment, const Wiring& wiring) {
+        this->_wiring[segment] = &wiring;
+    }
+
+    // Read each segment of the given volume, e.g. a CubeChain. Segments missing from it are blanked,
+    // so a single cube shows on the first segment only.
+    void prepare(const ICubeRO& cube) const {
+        for (uint8_t s = 0; s < Segments; s++) {
+            if (s < cube.segments()) {
+                cube.readSegment(s, this->_frames[s]);
+                this->_view.apply(this->_frames[s]);
+            } else {
+                this->_frames[s].clear();
+            }
+        }
+    }
+
+    void showLayer(uint8_t z) const {
+        uint8_t rows[8];
+        this->latch();
+        for (uint8_t s = Segments; s-- > 0;) {
+            this->shift(0x01 << z);
+            const Wiring* wiring = this->_wiring[s] ? this->_wiring[s] : &straightWiring;
+            wiring->layer(this->_frames[s], z, rows);
+            for (uint8_t i = 0; i < 8; i++) {
+                this->shift(rows[i]);
+            }
+        }
+        this->unlatch();
+    }
+
+    void blank() const {
+        this->latch();
+        for (uint16_t i = 0; i < 9 * Segments; i++) {
+            this->shift(0);
+        }
+        this->unlatch();
+    }
+
+   private:
+    const Wiring* _wiring[Segments] = {};
+    mutable Frame _frames[Segments];
+};
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <Arduino.h>
+
+#ifdef __AVR__
+#include <new.h>
+#else
+#include <new>
+#endif
+
+#include "ieffect.h"
+
+// EffectEntry describes how to build a registered effect.
+// Entries are constant and meant to live in flash (PROGMEM), only the active effect lives in RAM.
+struct EffectEntry {
+    // Construct the effect in place in the given memory.
+    IEffect* (*create)(void* mem);
+    // Size of the effect state, used to size the arena.
+    uint16_t size;
+};
+
+// EFFECT_FACTORY declares a named factory for the given effect type and constructor arguments.
+// ex:
+//   EFFECT_FACTORY(rainDown, Rain, 100, 5, -Plane::Z);
+//   constexpr EffectEntry effects[] PROGMEM = {EFFECT_ENTRY(rainDown)};
+#define EFFECT_FACTORY(name, type, ...)                \
+    struct name {                                      \
+        typedef type effect;                           \
+        static IEffect* create(void* mem) {            \
+            return new (mem) type(__VA_ARGS__);        \
+        }                                              \
+    }
+
+// EFFECT_ENTRY builds the registry entry for a factory declared with EFFECT_FACTORY.
+#define EFFECT_ENTRY(name) \
+    { &name::create, sizeof(name::effect) }
+
+// effectArenaSize looks up the largest effect state of the given registry at compile time.
+template <size_t N>
+constexpr size_t effectArenaSize(const EffectEntry (&entries)[N], size_t idx = 0, size_t size = 0) {
+    return idx == N ? size : effectArenaSize(entries, idx + 1, entries[idx].size > size ? entries[idx].size : size);
+}
+
+// effectIndex looks up the index of the given factory in the registry at compile time, -1 if missing.
+// ex:
+//   constexpr int rainIndex = effectIndex(effects, &rainDown::create);
+template <size_t N>
+constexpr int effectIndex(const EffectEntry (&entries)[N], IEffect* (*create)(void*), size_t idx = 0) {
+    return idx == N ? -1 : entries[idx].create == create ? idx : effectIndex(entries, create, idx + 1);
+}
+
+// EffectArena is the static storage shared by all the effects, only one of them is alive at a time.
+template <size_t Size>
+struct EffectArena {
+    alignas(8) uint8_t data[Size];
+};
+
+// freeMemory returns the amount of RAM left between the heap and the stack.
+inline int freeMemory() {
+#if defined(__AVR__)
+    extern char* __brkval;
+    extern char __heap_start;
+    char top;
+    return &top - (__brkval ? __brkval : &__heap_start);
+#elif defined(ESP8266)
+    return ESP.getFreeHeap();
+#else
+    return 0;
+#endif
+}
+
+// EffectRegistry owns the active effect.
+// Effects are constructed in place in the arena when activated and destroyed when switching to the next one.
+class EffectRegistry {
+   public:
+    template <size_t N, size_t Size>
+    EffectRegistry(const EffectEntry (&entries)[N], EffectArena<Size>& arena) : _entries(entries),
+                                                                                _size(N),
+                                                                                _arena(arena.data),
+                                                                                _arenaSize(Size) {
+    }
+
+    // Registry over an arena allocated at runtime, e.g. one per thread on the host to run effects in parallel.
+    // The arena must be aligned for the effects and at least as large as the largest of them.
+    EffectRegistry(const EffectEntry* entries, int size, void* arena, size_t arenaSize) : _entries(entries),
+                                                                                         _size(size),
+                                                                                         _arena(arena),
+                                                                                         _arenaSize(arenaSize) {
+    }
+
+    ~EffectRegistry() {
+        this->release();
+    }
+
+    // Number of registered effects.
+    int size() const {
+        return this->_size;
+    }
+
+    // State size of the given effect, read from flash.
+    uint16_t stateSize(int idx) const {
+        return pgm_read_word(&this->_entries[idx].size);
+    }
+
+    // Destroy the current effect and construct the requested one in its place.
+    // Returns 0, with no current effect, for an unknown index or an effect larger than the arena.
+    IEffect* activate(int idx) {
+        this->release();
+
+        if (idx < 0 || idx >= this->_size) {
+            return 0;
+        }
+        // Should not happen as the arena is sized on the registry, but better be safe than corrupting the RAM.
+        if (this->stateSize(idx) > this->_arenaSize) {
+            return 0;
+        }
+
+        IEffect* (*create)(void*) = (IEffect * (*)(void*)) pgm_read_ptr(&this->_entries[idx].create);
+        this->_current = create(this->_arena);
+        this->_current->attach(this->_rng);
+        return this->_current;
+    }
+
+    IEffect* current() const {
+        return this->_current;
+    }
+
+    // Random generator shared by the registered effects. Seed it for reproducible runs.
+    Rng& rng() {
+        return this->_rng;
+    }
+
+    // Print the state size of each effect along with the arena size and the remaining RAM.
+    void report(Print& out) const {
+        for (int i = 0; i < this->_size; i++) {
+            out.print("Effect #");
+            out.print(i);
+            out.print(": ");
+            out.print(this->stateSize(i));
+            out.println(" bytes");
+        }
+        out.print("Effect arena: ");
+        out.print((unsigned int)this->_arenaSize);
+        out.println(" bytes");
+        out.print("Free RAM: ");
+        out.print(freeMemory());
+        out.println(" bytes");
+    }
+
+   private:
+    void release() {
+        if (this->_current) {
+            this->_current->~IEffect();
+            this->_current = 0;
+        }
+    }
+
+   private:
+    const EffectEntry* _entries;
+    int _size;
+    void* _arena;
+    size_t _arenaSize;
+    IEffect* _current = 0;
+    Rng _rng;
+};
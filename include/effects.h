@@ -1,42 +1,17 @@
+#pragma once
+
 #include <Arduino.h>
 
+#include "audio.h"
+#include "bitmatrix.h"
 #include "cube.h"
-
-class IEffect {
-   public:
-    virtual void init(ICube& cube) {}
-
-    virtual bool ready(unsigned long currentTime) = 0;
-    virtual void step(ICube& cube) = 0;
-
-    virtual void loop(unsigned long currentTime, ICube& cube) {
-        if (this->ready(currentTime)) {
-            this->step(cube);
-        }
-    }
-};
-
-class BaseEffect : public IEffect {
-   public:
-    BaseEffect(unsigned int stepInterval) {
-        this->_interval = stepInterval;
-        this->_last = 0;
-    }
-
-    bool ready(unsigned long currentTime) {
-        if (currentTime - this->_last < (unsigned int)this->_interval) {
-            return false;
-        }
-        this->_last = currentTime;
-        return true;
-    }
-
-    virtual void step(ICube& cube) = 0;
-
-   private:
-    unsigned int _interval;
-    unsigned long _last;
-};
+#include "effectregistry.h"
+#include "expr.h"
+#include "fixedmath.h"
+#include "ieffect.h"
+#include "life.h"
+#include "log.h"
+#include "particles.h"
 
 class EffectCycler : public BaseEffect {
    public:
@@ -46,18 +21,10 @@ class EffectCycler : public BaseEffect {
         fixed,
     };
 
-    // Expect null terminated effects list.
-    EffectCycler(unsigned int speed, IEffect* effects[], mode mode = mode::sequence) : BaseEffect(speed),
-                                                                                       _cycleMode(mode),
-                                                                                       _effects(effects) {
-        // Lookup the list size.
-        for (this->_size = 0; effects[this->_size]; ++this->_size) {
-        };
-    }
-
-    EffectCycler(IEffect* effect) : BaseEffect(1000) {
-        this->_effects = &this->_placeHolder;
-        *this = effect;
+    EffectCycler(unsigned int speed, EffectRegistry& registry, mode mode = mode::sequence) : BaseEffect(speed),
+                                                                                          _cycleMode(mode),
+                                                                                          _registry(registry) {
+        this->attach(registry.rng());
     }
 
     void step(ICube& cube) {
@@ -65,29 +32,40 @@ class EffectCycler : public BaseEffect {
             case mode::fixed:
                 return;
             case mode::random:
-                this->_idx = ::random(0, this->_size);
+                this->_idx = this->rng().below(this->_registry.size());
                 break;
             case mode::sequence:
             default:
-                this->_idx = (this->_idx + 1) % this->_size;
+                this->_idx = (this->_idx + 1) % this->_registry.size();
                 break;
         }
-        Serial.print("Now using effect #");
-        Serial.print(this->_idx);
-        Serial.print(" (size: ");
-        Serial.print(this->_size);
-        Serial.println(")");
-        // Clear the cube and call the effect init.
+        // Clear the cube, construct the next effect in place of the previous one and call its init.
+        // Entries the registry can't construct are skipped.
         cube.clear();
-        this->current()->init(cube);
+        for (int i = 0; i < this->_registry.size(); i++) {
+            if (IEffect* effect = this->_registry.activate(this->_idx)) {
+                LOG_INFO("Now using effect #%d (size: %d)", this->_idx, this->_registry.size());
+                effect->init(cube);
+                return;
+            }
+            LOG_WARN("Skipping effect #%d", this->_idx);
+            this->_idx = (this->_idx + 1) % this->_registry.size();
+        }
     }
 
     IEffect* current() const {
-        return this->_effects[this->_idx];
+        return this->_registry.current();
+    }
+
+    // Index of the current effect in the registry.
+    int index() const {
+        return this->_idx;
     }
 
+    // Construct the given effect. The caller is expected to call init.
     EffectCycler& operator=(int idx) {
         this->_idx = idx;
+        this->_registry.activate(idx);
         return *this;
     }
 
@@ -96,24 +74,38 @@ class EffectCycler : public BaseEffect {
         return *this;
     }
 
-    EffectCycler& operator=(IEffect* effect) {
-        this->_idx = 0;
-        this->_size = 1;
-        this->_cycleMode = mode::fixed;
-        this->_effects[0] = effect;
-        return *this;
+   private:
+    mode _cycleMode = mode::sequence;
+    int _idx = 0;
+    EffectRegistry& _registry;
+};
+
+// Oriented runs an effect in its own orientation and displays it through the given view.
+// A single effect implementation then covers all the axes and directions.
+// ex:
+//   // Rain falls along -Z, make it fall along +X.
+//   Oriented<Rain> rain(View::align(-Plane::Z, +Plane::X), 100, 5);
+template <typename Effect>
+class Oriented : public Effect {
+   public:
+    template <typename... Args>
+    Oriented(const View& view, Args... args) : Effect(args...), _view(view), _inverse(view.inverse()) {}
+
+    void init(ICube& cube) {
+        cube.transform(this->_inverse);
+        Effect::init(cube);
+        cube.transform(this->_view);
     }
 
-    IEffect* operator[](int idx) {
-        return this->_effects[idx];
+    void step(ICube& cube) {
+        cube.transform(this->_inverse);
+        Effect::step(cube);
+        cube.transform(this->_view);
     }
 
    private:
-    mode _cycleMode = mode::sequence;
-    int _idx = 0;
-    int _size;
-    IEffect** _effects;
-    IEffect* _placeHolder;
+    View _view;
+    View _inverse;
 };
 
 // VoxelExplorer is mostly to test the wiring of the cube.
@@ -147,33 +139,46 @@ class VoxelExplorer : public BaseEffect {
 
 // Rain creates a rain effect:
 // - Turn on a random number of leds (up to maxDroplets) on the first layer (based on plane direction).
-// - Shift the cube based on the plane direction so the previously lit leds "fall" to the next layer.
-// - Reset the first layer.
+// - Move the droplets by one layer along the plane direction, dropping the ones leaving the cube.
 // - Repeat.
 class Rain : public BaseEffect {
    public:
     Rain(unsigned int speed, unsigned int maxDroplets = 5, const Plane& p = -Plane::Z) : BaseEffect(speed),
-                                                                                         _maxDroplets(maxDroplets),
-                                                                                         _plane(p) {
+                                                                                         _maxDroplets(maxDroplets) {
+        // Droplets spawn anywhere on the first/last layer based on the plane direction
+        // and fall by one layer each step.
+        const int axis = (Plane::axis)p - 1;
+        const int direction = (Plane::direction)p;
+        for (int i = 0; i < 3; i++) {
+            this->_clouds.origin[i] = 0;
+            this->_clouds.extent[i] = 8 * FIXED_ONE;
+            this->_clouds.velocity[i] = 0;
+        }
+        this->_clouds.origin[axis] = FIXED_VOXEL(direction == Plane::direction::positive ? 0 : 7);
+        this->_clouds.extent[axis] = 0;
+        this->_clouds.velocity[axis] = direction * FIXED_ONE;
+        this->_clouds.spread = 0;
+        this->_clouds.life = 0;
     }
 
     void step(ICube& cube) {
-        // Shift the whole cube along the plane.
-        cube.shift(this->_plane);
-
-        // Populate the first or last layer based on the the plane direction.
-        int offset = this->_plane == Plane::direction::positive ? 0 : 7;
+        // Move the droplets, the ones leaving the cube are gone.
+        this->_drops.update();
 
         // Generate random droplets for the first/last layer.
-        int numDrops = ::random(0, this->_maxDroplets);
-        for (int i = 0; i < numDrops; i++) {
-            cube.setVoxel(this->_plane(offset), random(0, 8), random(0, 8), 1);
-        }
+        this->_clouds.emit(this->_drops, this->rng(), this->rng().below(this->_maxDroplets));
+
+        Frame frame;
+        frame.clear();
+        this->_drops.render(frame);
+        cube.write(frame);
     }
 
    private:
     unsigned int _maxDroplets;
-    const Plane _plane;
+    Emitter _clouds;
+    // Enough for 8 layers of maxDroplets - 1 droplets with the default settings.
+    ParticlePool<40> _drops;
 };
 
 // PlaneBoing lights a single layer plane and moves it accross the cube.
@@ -219,57 +224,149 @@ class PlaneBoing : public BaseEffect {
 };
 
 // SendVoxel lights random LEDs on 2 opposite layer planes (first and last) then "moves"
-// LEDs randomly, one by one along the axis, lightning up each LED on the way.
+// LEDs randomly, one by one (or up to maxInFlight at once) along the axis, lightning up each LED on the way.
 class SendVoxels : public BaseEffect {
    public:
-    SendVoxels(unsigned long speed, Plane::axis axis = Plane::Z) : BaseEffect(speed), _plane(axis) {}
+    SendVoxels(unsigned long speed, Plane::axis axis = Plane::Z, uint8_t maxInFlight = 1) : BaseEffect(speed),
+                                                                                             _axis(axis),
+                                                                                             _maxInFlight(maxInFlight > SendVoxels::capacity ? SendVoxels::capacity : maxInFlight),
+                                                                                             _sent(Sent::walls::kill) {
+    }
 
     void init(ICube& cube) {
         // Start by lightning up a layer and randomly spread it among the edges.
-        for (int i = 0; i < 8; i++) {
-            for (int j = 0; j < 8; j++) {
-                // Randomly pick the first or last layer.
-                int k = ::random(0, 2) % 2 ? 0 : 7;
+        // Draw one random bit per voxel at once, set for the last layer.
+        this->_last = this->rng().bits64();
+        this->_flying = 0;
+        this->_sent.clear();
+        this->render(cube);
+    }
+
+    void step(ICube& cube) {
+        // Move the voxels being sent, they live until they reach the other side.
+        this->_sent.update();
 
-                cube.setVoxel(this->_plane(k), i, j, 1);
+        // Voxels not flying anymore landed on the other side.
+        uint64_t flying = 0;
+        for (uint8_t i = 0; i < this->_sent.size(); i++) {
+            flying |= (uint64_t)1 << (this->_sent.voxel(i, 0) * 8 + this->_sent.voxel(i, 1));
+        }
+        this->_last ^= this->_flying & ~flying;
+        this->_flying = flying;
+
+        // Pick a random resting voxel to send.
+        if (this->_sent.size() < this->_maxInFlight && this->_flying != ~(uint64_t)0) {
+            uint8_t c;
+            do {
+                c = this->rng().bits(6);
+            } while ((this->_flying >> c) & 1);
+
+            const bool last = (this->_last >> c) & 1;
+            // A voxel marked flying without a particle would land on the other side at the next step.
+            if (this->_sent.emit(FIXED_VOXEL(c / 8), FIXED_VOXEL(c % 8), FIXED_VOXEL(last ? 7 : 0),
+                                 0, 0, last ? -FIXED_ONE : FIXED_ONE,
+                                 8)) {
+                this->_flying |= (uint64_t)1 << c;
             }
         }
+
+        this->render(cube);
+    }
+
+   private:
+    void render(ICube& cube) {
+        // Resting voxels on the first/last layer, then the flying ones. The voxels are sent along z,
+        // column c being the voxel (c / 8, c % 8) of the planes of the requested axis.
+        const uint64_t resting = ~this->_flying;
+        cube.clear();
+        cube.setLayer(Plane(this->_axis, 0), resting & ~this->_last);
+        cube.setLayer(Plane(this->_axis, 7), resting & this->_last);
+        for (uint8_t i = 0; i < this->_sent.size(); i++) {
+            cube.setVoxel(Plane(this->_axis, this->_sent.voxel(i, 2)), this->_sent.voxel(i, 0), this->_sent.voxel(i, 1), 1);
+        }
+    }
+
+   private:
+    // Most voxels in flight at once.
+    static const uint8_t capacity = 8;
+    typedef ParticlePool<SendVoxels::capacity> Sent;
+
+    Plane::axis _axis;
+    uint8_t _maxInFlight;
+    // One bit per column (x * 8 + y): set when the resting voxel is on the last layer.
+    uint64_t _last = 0;
+    // One bit per column being sent.
+    uint64_t _flying = 0;
+    Sent _sent;
+};
+
+// Fireworks launches rockets from the floor, exploding at the top of their course into sparks
+// falling and bouncing on the walls until they fade out.
+class Fireworks : public BaseEffect {
+   public:
+    Fireworks(unsigned int speed = 30) : BaseEffect(speed), _sparks(Sparks::walls::bounce) {
+        this->_sparks.setGravity(0, 0, -Fireworks::gravity);
+        this->_sparks.setRestitution(FIXED_ONE / 2);
+        this->_rocket.setGravity(0, 0, -Fireworks::gravity);
     }
 
     void step(ICube& cube) {
-        // If we are not currently sending a voxel, pick one to send.
-        if (!this->_sending) {
-            // Pick a random point in the plane.
-            this->_i = ::random(0, 8);
-            this->_j = ::random(0, 8);
-
-            // Check if the layer 0 is lit.
-            if (cube.getVoxel(this->_plane(0), this->_i, this->_j)) {
-                this->_plane = +this->_plane(0);
-            } else {
-                this->_plane = -this->_plane(7);
-            }
+        this->_sparks.update();
 
-            this->_sending = true;
-            return;
+        if (this->_rocket.size()) {
+            this->_rocket.update();
+            // Explode at the top of the course.
+            if (this->_rocket.velocity(0, 2) <= 0) {
+                this->explode();
+            }
+        } else if (this->_sparks.size() < Fireworks::capacity / 4) {
+            this->launch();
         }
 
-        // If we are sending, turn off the current LED and light up the next one.
-        cube.setVoxel(this->_plane, this->_i, this->_j, 0);
-        ++this->_plane;
-        cube.setVoxel(this->_plane, this->_i, this->_j, 1);
+        Frame frame;
+        frame.clear();
+        this->_sparks.render(frame);
+        this->_rocket.render(frame);
+        cube.write(frame);
+    }
 
-        // When we reach the first or last layer, reset the sending flag and start again.
-        if ((int)this->_plane <= 0 || (int)this->_plane >= 7) {
-            this->_sending = false;
+   private:
+    // Launch a rocket from a random position of the floor, high enough to explode in the upper half.
+    void launch() {
+        this->_rocket.emit(FIXED_VOXEL(1 + this->rng().below(6)),
+                           FIXED_VOXEL(1 + this->rng().below(6)),
+                           FIXED_VOXEL(0),
+                           0, 0, 100 + this->rng().below(40));
+    }
+
+    // Replace the rocket with a burst of sparks.
+    void explode() {
+        Emitter burst;
+        for (int i = 0; i < 3; i++) {
+            burst.origin[i] = this->_rocket.voxel(0, i) * FIXED_ONE + FIXED_ONE / 2;
+            burst.extent[i] = 0;
+            burst.velocity[i] = 0;
         }
+        burst.spread = 96;
+        burst.life = 24 + this->rng().below(24);
+        burst.emit(this->_sparks, this->rng(), 40 + this->rng().below(40));
+        this->_rocket.clear();
     }
 
    private:
-    int _i;
-    int _j;
-    Plane _plane;
-    bool _sending = false;
+#ifdef __AVR__
+    // 13 bytes per spark, the effect then stays within the size of the bytecode one, see EFFECT_ARENA_BUDGET.
+    static const uint8_t capacity = 40;
+#else
+    static const uint8_t capacity = 128;
+#endif
+    // Gravity in 8.8 voxels per step^2.
+    static const fixed gravity = 6;
+
+    typedef ParticlePool<Fireworks::capacity> Sparks;
+
+    Sparks _sparks;
+    ParticlePool<1> _rocket;
 };
 
 class FullyOn : public BaseEffect {
@@ -285,23 +382,6 @@ class FullyOn : public BaseEffect {
     void step(ICube& cube) {}
 };
 
-void drawCube(ICube& cube, int x, int y, int z, int size) {
-    for (int i = 0; i < size; i++) {
-        cube.setVoxel(x, y + i, z, 1);
-        cube.setVoxel(x + i, y, z, 1);
-        cube.setVoxel(x, y, z + i, 1);
-        cube.setVoxel(x + size - 1, y + i, z + size - 1, 1);
-        cube.setVoxel(x + i, y + size - 1, z + size - 1, 1);
-        cube.setVoxel(x + size - 1, y + size - 1, z + i, 1);
-        cube.setVoxel(x + size - 1, y + i, z, 1);
-        cube.setVoxel(x, y + i, z + size - 1, 1);
-        cube.setVoxel(x + i, y + size - 1, z, 1);
-        cube.setVoxel(x + i, y, z + size - 1, 1);
-        cube.setVoxel(x + size - 1, y, z + i, 1);
-        cube.setVoxel(x, y + size - 1, z + i, 1);
-    }
-}
-
 // WoopWoop draws a cube in the center, growing and shrinking betwen 2x2x2 and 8x8x8 (lightning only the edges).
 class WoopWoop : public BaseEffect {
    public:
@@ -323,9 +403,10 @@ class WoopWoop : public BaseEffect {
                 this->_expanding = true;
             }
         }
-        // Clean the state and draw the new sized cube.
-        cube.clear();
-        drawCube(cube, 4 - this->_size / 2, 4 - this->_size / 2, 4 - this->_size / 2, this->_size);
+        // Replace the state with the new sized cube.
+        const int from = 4 - this->_size / 2;
+        const int to = from + this->_size - 1;
+        cube = edges(from, from, from, to, to, to);
     }
 
    private:
@@ -339,33 +420,20 @@ class CubeJump : public BaseEffect {
     CubeJump(unsigned int speed) : BaseEffect(speed) {}
 
     void init(ICube& cube) {
-        this->_xPos = ::random(0, 2) * 7;
-        this->_yPos = ::random(0, 2) * 7;
-        this->_zPos = ::random(0, 2) * 7;
+        this->_xPos = this->rng().coin() * 7;
+        this->_yPos = this->rng().coin() * 7;
+        this->_zPos = this->rng().coin() * 7;
         this->_size = 8;
         this->_expanding = false;
     }
 
     void step(ICube& cube) {
-        cube.clear();
+        // The cube keeps its corner, sizes down to 0 draw nothing.
+        const int x = this->_xPos ? 8 - this->_size : 0;
+        const int y = this->_yPos ? 8 - this->_size : 0;
+        const int z = this->_zPos ? 8 - this->_size : 0;
+        cube = edges(x, y, z, x + this->_size - 1, y + this->_size - 1, z + this->_size - 1);
 
-        if (this->_xPos == 0 && this->_yPos == 0 && this->_zPos == 0) {
-            drawCube(cube, this->_xPos, this->_yPos, this->_zPos, this->_size);
-        } else if (this->_xPos == 7 && this->_yPos == 7 && this->_zPos == 7) {
-            drawCube(cube, this->_xPos + 1 - this->_size, this->_yPos + 1 - this->_size, this->_zPos + 1 - this->_size, this->_size);
-        } else if (this->_xPos == 7 && this->_yPos == 0 && this->_zPos == 0) {
-            drawCube(cube, this->_xPos + 1 - this->_size, this->_yPos, this->_zPos, this->_size);
-        } else if (this->_xPos == 0 && this->_yPos == 7 && this->_zPos == 0) {
-            drawCube(cube, this->_xPos, this->_yPos + 1 - this->_size, this->_zPos, this->_size);
-        } else if (this->_xPos == 0 && this->_yPos == 0 && this->_zPos == 7) {
-            drawCube(cube, this->_xPos, this->_yPos, this->_zPos + 1 - this->_size, this->_size);
-        } else if (this->_xPos == 7 && this->_yPos == 7 && this->_zPos == 0) {
-            drawCube(cube, this->_xPos + 1 - this->_size, this->_yPos + 1 - this->_size, this->_zPos, this->_size);
-        } else if (this->_xPos == 0 && this->_yPos == 7 && this->_zPos == 7) {
-            drawCube(cube, this->_xPos, this->_yPos + 1 - this->_size, this->_zPos + 1 - this->_size, this->_size);
-        } else if (this->_xPos == 7 && this->_yPos == 0 && this->_zPos == 7) {
-            drawCube(cube, this->_xPos + 1 - this->_size, this->_yPos, this->_zPos + 1 - this->_size, this->_size);
-        }
         if (this->_expanding) {
             if (this->_size++ == 8) {
                 this->init(cube);
@@ -403,7 +471,7 @@ class Glowing : public BaseEffect {
         }
 
         int c = 0;
-        int pick = ::random(0, 512 - this->_count++);
+        int pick = this->rng().below(512 - this->_count++);
 
         for (int i = 0; i < 8; i++) {
             for (int j = 0; j < 8; j++) {
@@ -424,6 +492,189 @@ class Glowing : public BaseEffect {
     int _count = 0;
 };
 
+// SineWave draws a sine wave surface travelling along the diagonal of the cube.
+class SineWave : public BaseEffect {
+   public:
+    SineWave(unsigned int speed = 20) : BaseEffect(speed) {}
+
+    void step(ICube& cube) {
+        const uint8_t phase = this->_phase += 6;
+
+        Frame frame;
+        evalColumns(frame, [phase](int x, int y) {
+            // One height in [0, 7] per column.
+            return columnSurface((isin((x + y) * 16 - phase) + 256) >> 6);
+        });
+        cube.write(frame);
+    }
+
+   private:
+    uint8_t _phase = 0;
+};
+
+// Ripple draws circular waves going out of the center of the cube, like a drop in water.
+class Ripple : public BaseEffect {
+   public:
+    Ripple(unsigned int speed = 20) : BaseEffect(speed) {}
+
+    void step(ICube& cube) {
+        const uint8_t phase = this->_phase += 8;
+
+        Frame frame;
+        evalColumns(frame, [phase](int x, int y) {
+            // Distance to the center in 1/32th of voxel, a wave length being 4 voxels.
+            const uint16_t dist = approxDist((2 * x - 7) * 16, (2 * y - 7) * 16);
+            return columnSurface((isin(dist * 2 - phase) + 256) >> 6);
+        });
+        cube.write(frame);
+    }
+
+   private:
+    uint8_t _phase = 0;
+};
+
+// Plasma lights the voxels where a sum of moving sine waves goes above a threshold, giving moving blobs.
+// The field is separable: the waves are evaluated once per coordinate, then summed per voxel.
+class Plasma : public BaseEffect {
+   public:
+    Plasma(unsigned int speed = 20, int16_t threshold = 320) : BaseEffect(speed), _threshold(threshold) {}
+
+    void step(ICube& cube) {
+        const uint8_t t = ++this->_time;
+
+        int16_t sx[8], sy[8], sz[8], sd[22];
+        for (int i = 0; i < 8; i++) {
+            sx[i] = isin(i * 24 + t);
+            sy[i] = isin(i * 20 - 2 * t);
+            sz[i] = isin(i * 28 + 3 * t);
+        }
+        for (int i = 0; i < 22; i++) {
+            sd[i] = isin(i * 12 - t);
+        }
+
+        Frame frame;
+        for (int z = 0; z < 8; z++) {
+            for (int x = 0; x < 8; x++) {
+                const int16_t base = sz[z] + sx[x] - this->_threshold;
+                uint8_t row = 0;
+                for (int y = 0; y < 8; y++) {
+                    row |= (base + sy[y] + sd[x + y + z] > 0) << y;
+                }
+                frame.rows[z][x] = row;
+            }
+        }
+        cube.write(frame);
+    }
+
+   private:
+    int16_t _threshold;
+    uint8_t _time = 0;
+};
+
+// Spectrum shows the audio input as 8 bands, lows at x = 0, as a waterfall: the front row (y = 0) is the
+// latest spectrum and older ones scroll towards the back. The gain follows the loudest band.
+// The ADC only runs while the effect is active.
+class Spectrum : public BaseEffect {
+   public:
+    Spectrum(unsigned int speed = 30, uint8_t pin = A0) : BaseEffect(speed), _input(pin) {}
+
+    void init(ICube& cube) {
+        this->_input.begin();
+    }
+
+    // Drain the samples on every loop, the ring only holds about 53ms of audio.
+    void loop(unsigned long currentTime, ICube& cube) {
+        uint8_t sample;
+        this->_input.poll();
+        while (this->_input.read(sample)) {
+            this->_fresh |= this->_analyzer.feed(sample);
+        }
+        BaseEffect::loop(currentTime, cube);
+    }
+
+    void step(ICube& cube) {
+        if (!this->_fresh) {
+            return;
+        }
+        this->_fresh = false;
+
+        uint16_t loudest = 0;
+        for (uint8_t x = 0; x < AUDIO_BANDS; x++) {
+            if (this->_analyzer.band(x) > loudest) {
+                loudest = this->_analyzer.band(x);
+            }
+        }
+        // Instant attack, slow release, with a floor so silence stays dark.
+        this->_peak = loudest > this->_peak ? loudest : this->_peak - (this->_peak >> 5);
+        const uint16_t peak = this->_peak > 8 ? this->_peak : 8;
+
+        for (uint8_t x = 0; x < AUDIO_BANDS; x++) {
+            memmove(&this->_columns[x][1], &this->_columns[x][0], 7);
+            this->_columns[x][0] = columnBar((int)((uint32_t)this->_analyzer.band(x) * 8 / peak) - 1);
+        }
+
+        Frame frame;
+        renderColumns(this->_columns, frame);
+        cube.write(frame);
+    }
+
+   private:
+    AudioInput _input;
+    SpectrumAnalyzer _analyzer;
+    bool _fresh = false;
+    uint16_t _peak = 0;
+    // Column masks, see renderColumns.
+    uint8_t _columns[8][8] = {};
+};
+
+// Life3D runs a 3D life-like cellular automaton, see LifeRule. The cube is reseeded when it dies out
+// or when it stagnates, i.e. when a generation repeats one of the last few.
+class Life3D : public BaseEffect {
+   public:
+    Life3D(unsigned int speed = 200, LifeRule rule = LifeRule::bays(4, 5, 5, 5), bool wrap = true) : BaseEffect(speed),
+                                                                                                      _rule(rule),
+                                                                                                      _wrap(wrap) {}
+
+    void init(ICube& cube) {
+        this->seed();
+        cube.write(this->_frame);
+    }
+
+    void step(ICube& cube) {
+        lifeStep(this->_frame, this->_frame, this->_rule, this->_wrap);
+
+        // Catches still lifes and oscillators up to the history length, empty cubes included.
+        const uint32_t hash = this->_frame.hash();
+        bool stagnant = false;
+        for (uint8_t i = 0; i < sizeof(this->_history) / sizeof(this->_history[0]); i++) {
+            stagnant |= this->_history[i] == hash;
+        }
+        this->_history[this->_generation++ % (sizeof(this->_history) / sizeof(this->_history[0]))] = hash;
+        if (stagnant) {
+            this->seed();
+        }
+
+        cube.write(this->_frame);
+    }
+
+   private:
+    // Random soup, about a quarter of the cells alive.
+    void seed() {
+        for (int z = 0; z < 8; z++) {
+            const uint64_t layer = this->rng().bits64() & this->rng().bits64();
+            memcpy(this->_frame.rows[z], &layer, 8);
+        }
+        memset(this->_history, 0, sizeof(this->_history));
+    }
+
+   private:
+    LifeRule _rule;
+    bool _wrap;
+    Frame _frame;
+    uint32_t _history[4];
+    uint8_t _generation = 0;
+};
+
 // Drawing of the chars to display.
 static const unsigned char _characters[][8] = {
     {
@@ -540,12 +791,17 @@ class Numbers : public BaseEffect {
         // If we are at the first/last layer (based on direction), draw the curent number.
         if (this->_plane == (this->_plane == Plane::direction::negative ? 7 : 0)) {
             // Just in case, make sure we have a clean state.
+            // The voxel i, 7 - j of the plane is the bit 7 - i of the character row j:
+            // mirror the rows, transpose, then mirror again for the 7 - j.
+            uint8_t layer[8];
+            memcpy(layer, _characters[this->_idx], 8);
+            reverseColumns(layer);
+            transpose8(layer);
+            reverseColumns(layer);
+            uint64_t bits;
+            memcpy(&bits, layer, 8);
             cube.clear();
-            for (int i = 0; i < 8; i++) {
-                for (int j = 0; j < 8; j++) {
-                    cube.setVoxel(this->_plane, i, 7 - j, _characters[this->_idx][j] & (1 << (7 - i)) ? 1 : 0);
-                }
-            }
+            cube.setLayer(this->_plane, bits);
         }
         // Shift the plane following the direction.
         ++this->_plane;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "cube.h"
+#include "expr.h"
+
+// The same drawings done eagerly, voxel by voxel, and as fused cube expressions, see expr.h.
+// Each version is its own function so their code sizes can be compared in the symbol table:
+//   avr-nm --size-sort -C .pio/build/bench/firmware.elf | grep expr
+
+// Both versions draw into cube, reading other, and must leave the same voxels.
+struct ExprBenchPair {
+    const char* name;
+    void (*eager)(ICube& cube, const Cube& other);
+    void (*fused)(ICube& cube, const Cube& other);
+};
+
+// Edges of a 6x6x6 cube, as WoopWoop draws them.
+__attribute__((noinline)) static void exprEdgesEager(ICube& cube, const Cube&) {
+    cube.clear();
+    for (int i = 0; i < 6; i++) {
+        cube.setVoxel(1, 1 + i, 1, 1);
+        cube.setVoxel(1 + i, 1, 1, 1);
+        cube.setVoxel(1, 1, 1 + i, 1);
+        cube.setVoxel(6, 1 + i, 6, 1);
+        cube.setVoxel(1 + i, 6, 6, 1);
+        cube.setVoxel(6, 6, 1 + i, 1);
+        cube.setVoxel(6, 1 + i, 1, 1);
+        cube.setVoxel(1, 1 + i, 6, 1);
+        cube.setVoxel(1 + i, 6, 1, 1);
+        cube.setVoxel(1 + i, 1, 6, 1);
+        cube.setVoxel(6, 1, 1 + i, 1);
+        cube.setVoxel(1, 6, 1 + i, 1);
+    }
+}
+
+__attribute__((noinline)) static void exprEdgesFused(ICube& cube, const Cube&) {
+    cube = edges(1, 1, 1, 6, 6, 6);
+}
+
+// Two overlapping boxes, hollowed by a sphere of radius 3 at the center.
+__attribute__((noinline)) static void exprCsgEager(ICube& cube, const Cube&) {
+    cube.clear();
+    for (int x = 0; x < 8; x++) {
+        for (int y = 0; y < 8; y++) {
+            for (int z = 0; z < 8; z++) {
+                if ((x <= 4 && y <= 4 && z <= 4) || (x >= 3 && y >= 3 && z >= 3)) {
+                    cube.setVoxel(x, y, z, 1);
+                }
+            }
+        }
+    }
+    for (int x = 0; x < 8; x++) {
+        for (int y = 0; y < 8; y++) {
+            for (int z = 0; z < 8; z++) {
+                if ((2 * x - 7) * (2 * x - 7) + (2 * y - 7) * (2 * y - 7) + (2 * z - 7) * (2 * z - 7) <= 36) {
+                    cube.setVoxel(x, y, z, 0);
+                }
+            }
+        }
+    }
+}
+
+__attribute__((noinline)) static void exprCsgFused(ICube& cube, const Cube&) {
+    cube = (box(0, 0, 0, 4, 4, 4) | box(3, 3, 3, 7, 7, 7)) & ~sphere(7, 7, 7, 6);
+}
+
+// Two walls filled over the current content, then the middle layer toggled.
+__attribute__((noinline)) static void exprLayersEager(ICube& cube, const Cube&) {
+    cube.fill(Plane::X(0), 1);
+    cube.fill(Plane::Y(7), 1);
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            cube.setVoxel(Plane::Z(3), i, j, !cube.getVoxel(Plane::Z(3), i, j));
+        }
+    }
+}
+
+__attribute__((noinline)) static void exprLayersFused(ICube& cube, const Cube&) {
+    // Compound assignments read the cube once as a frame, rows(cube) would read it row by row through the interface.
+    cube |= layer(Plane::X(0)) | layer(Plane::Y(7));
+    cube ^= layer(Plane::Z(3));
+}
+
+// Another cube xored in after a quarter turn, around x rows are gathered across, around y they stay rows.
+template <Plane::axis Axis>
+__attribute__((noinline)) static void exprRotateEager(ICube& cube, const Cube& other) {
+    const View view = View::rotate(Axis);
+    int p[3];
+    for (int x = 0; x < 8; x++) {
+        for (int y = 0; y < 8; y++) {
+            for (int z = 0; z < 8; z++) {
+                view.sourceVoxel(x, y, z, p);
+                cube.setVoxel(x, y, z, cube.getVoxel(x, y, z) ^ other.getVoxel(p[0], p[1], p[2]));
+            }
+        }
+    }
+}
+
+template <Plane::axis Axis>
+__attribute__((noinline)) static void exprRotateFused(ICube& cube, const Cube& other) {
+    cube ^= transform(View::rotate(Axis), other);
+}
+
+static const ExprBenchPair exprBenchPairs[] = {
+    {"edges", exprEdgesEager, exprEdgesFused},
+    {"boxes & ~sphere", exprCsgEager, exprCsgFused},
+    {"layers", exprLayersEager, exprLayersFused},
+    {"^= rotate(x)", exprRotateEager<Plane::x>, exprRotateFused<Plane::x>},
+    {"^= rotate(y)", exprRotateEager<Plane::y>, exprRotateFused<Plane::y>},
+};
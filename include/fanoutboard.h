@@ -0,0 +1,66 @@
+#pragma once
+
+#include "ishiftboard.h"
+#include "wiring.h"
+
+// FanOutBoard serializes the cube once and shows it on several outputs, e.g. the cube on a SPIBoard and
+// a stream of the frames. Each output gets the layer rows through its own wiring table, outputs with
+// the straight wiring get the shared rows as is: an extra output costs no walk over the voxels.
+// Outputs are single cubes. The per voxel mapping is ignored, use the per output wiring instead.
+template <uint8_t Outputs>
+class FanOutBoard : public ILayerBoard {
+   public:
+    // Output i and its wiring, straight when null. Outputs and wirings are kept by pointer.
+    void setOutput(uint8_t i, const ILayerOutput& output, const Wiring* wiring = 0) {
+        this->_outputs[i] = &output;
+        this->_wirings[i] = wiring;
+    }
+
+    void setup() const {
+        for (uint8_t i = 0; i < Outputs; i++) {
+            if (this->_outputs[i]) {
+                this->_outputs[i]->setup();
+            }
+        }
+    }
+
+    void prepare(const ICubeRO& cube) const {
+        cube.read(this->_frame);
+        if (!this->_view.isIdentity()) {
+            this->_view.apply(this->_frame);
+        }
+        for (uint8_t i = 0; i < Outputs; i++) {
+            if (this->_outputs[i]) {
+                this->_outputs[i]->frame(this->_frame);
+            }
+        }
+    }
+
+    void showLayer(uint8_t z) const {
+        uint8_t rows[8];
+        for (uint8_t i = 0; i < Outputs; i++) {
+            if (!this->_outputs[i]) {
+                continue;
+            }
+            if (this->_wirings[i]) {
+                this->_wirings[i]->layer(this->_frame, z, rows);
+                this->_outputs[i]->showRows(z, rows);
+            } else {
+                this->_outputs[i]->showRows(z, this->_frame.rows[z]);
+            }
+        }
+    }
+
+    void blank() const {
+        for (uint8_t i = 0; i < Outputs; i++) {
+            if (this->_outputs[i]) {
+                this->_outputs[i]->blank();
+            }
+        }
+    }
+
+   private:
+    const ILayerOutput* _outputs[Outputs] = {};
+    const Wiring* _wirings[Outputs] = {};
+    mutable Frame _frame;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "bitmatrix.h"
+#include "frame.h"
+
+// Integer math for the waveform effects, floating point being way too slow on AVR.
+// Angles are in 1/256th of a turn, sines are scaled to [-255, 255].
+
+// Sine from a quarter wave table stored in flash.
+int16_t isin(uint8_t angle);
+
+inline int16_t icos(uint8_t angle) {
+    return isin(angle + 64);
+}
+
+// Integer square root, rounded down.
+uint16_t isqrt(uint32_t value);
+
+// Length of the (dx, dy) vector, within 7%, without multiplication nor root.
+uint16_t approxDist(int16_t dx, int16_t dy);
+// Length of the (dx, dy, dz) vector, within 9%.
+uint16_t approxDist(int16_t dx, int16_t dy, int16_t dz);
+
+// Column masks, bit z lighting the voxel at height z.
+// Single voxel at the given height, nothing outside of [0, 7].
+inline uint8_t columnSurface(int height) {
+    return height < 0 || height > 7 ? 0 : 1 << height;
+}
+
+// Voxels from the bottom up to the given height included.
+inline uint8_t columnBar(int height) {
+    return height < 0 ? 0 : height > 7 ? 0xff : (2 << height) - 1;
+}
+
+// Fill the frame from per column masks, columns[x][y] bit z being the voxel (x, y, z).
+// Each x slice is a bit matrix transpose away from the frame rows.
+inline void renderColumns(const uint8_t columns[8][8], Frame& frame) {
+    for (int x = 0; x < 8; x++) {
+        uint8_t m[8];
+        for (int y = 0; y < 8; y++) {
+            m[y] = columns[x][y];
+        }
+        transpose8(m);
+        for (int z = 0; z < 8; z++) {
+            frame.rows[z][x] = m[z];
+        }
+    }
+}
+
+// Evaluate mask(x, y) once per column and fill the frame with the resulting column masks.
+// ex:
+//   evalColumns(frame, [](int x, int y) { return columnBar(x + y - 7); });
+template <typename F>
+void evalColumns(Frame& frame, F mask) {
+    uint8_t columns[8][8];
+    for (int x = 0; x < 8; x++) {
+        for (int y = 0; y < 8; y++) {
+            columns[x][y] = mask(x, y);
+        }
+    }
+    renderColumns(columns, frame);
+}
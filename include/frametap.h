@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "cube.h"
+
+// Size of a frame tap record, see FrameTap.
+#define FRAME_TAP_RECORD_SIZE 74
+// Most bytes written per drain call, keeps a call well under the governor idle margin on the Uno.
+#define FRAME_TAP_CHUNK 16
+
+// FrameTap mirrors the displayed frames back to the host over Serial, for monitoring and recording
+// (see `ledcube tap`). It never waits on the link: records are written in chunks only when they fit
+// the TX buffer, which the UART interrupt empties, and frames are skipped when the link falls behind.
+//
+// Record layout, little endian:
+//   0xfc 0xcb   sync, never found in the ASCII log lines sharing the link.
+//   uint16      frame number, counting every captured frame so the host sees the skipped ones.
+//   uint32      capture time in ms.
+//   uint8       effect index, see EffectCycler::index.
+//   64 bytes    packed frame, see Frame.
+//   uint8       checksum, sum of the bytes from the frame number to the frame.
+class FrameTap {
+   public:
+    // Take the frame about to be displayed. It replaces the pending record if its sending didn't start,
+    // it is skipped if a record is halfway out.
+    void capture(const ICubeRO& cube, uint8_t effect, unsigned long now);
+
+    // Write what the output can take of the pending record without blocking, for Governor::setIdle.
+    // Returns true while a record is pending, the governor keeps calling it through the frame padding
+    // as the TX buffer empties.
+    bool drain(Print& out);
+
+    // Whether a record is halfway out, nothing else must be written to the output until it is done.
+    bool busy() const {
+        return this->_sent > 0 && this->_sent < FRAME_TAP_RECORD_SIZE;
+    }
+
+    // Frames captured but never sent since the start.
+    uint32_t skipped() const {
+        return this->_skipped;
+    }
+
+   private:
+    uint8_t _record[FRAME_TAP_RECORD_SIZE];
+    // Bytes of the record written, FRAME_TAP_RECORD_SIZE when there is nothing to send.
+    uint8_t _sent = FRAME_TAP_RECORD_SIZE;
+    uint16_t _frame = 0;
+    uint32_t _skipped = 0;
+};
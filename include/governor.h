@@ -0,0 +1,142 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "ishiftboard.h"
+
+// Time reserved for the effects work between two frames, in us, see Governor.
+#ifndef GOVERNOR_WORK_BUDGET
+#define GOVERNOR_WORK_BUDGET 4000
+#endif
+
+// Governor drives a layer by layer board, e.g. a shift register one, at a fixed refresh rate, lighting
+// every layer for the same on-time whatever the effects cost.
+//
+// A frame shows the 8 layers in turn, each for the on-time, then blanks the cube while the effects run.
+// The on-time is what the frame period leaves once a fixed work budget is taken out, not what the
+// current effect needs, so the duty cycle, i.e. the brightness, is the same for every effect. Lighter
+// frames leave the rest of the budget to the idle task and blank time. When the work doesn't fit the
+// budget, the frame stretches and the achieved fps drops, workTime tells how much the effects take.
+class Governor {
+   public:
+    Governor(const ILayerBoard& board, uint16_t fps = 100, unsigned long workBudget = GOVERNOR_WORK_BUDGET) : _board(board),
+                                                                                                               _period(1000000UL / fps),
+                                                                                                               _workBudget(workBudget) {}
+
+    // Display a frame of the cube then blank it. Call it once per loop, around the effects work.
+    void frame(const ICubeRO& cube) {
+        unsigned long now = ::micros();
+        // Nothing to measure nor to catch up with before the first frame, setup isn't effects work.
+        if (this->_started) {
+            this->measureWork(now - this->_workStart);
+        } else {
+            this->_next = now;
+            this->_started = true;
+        }
+
+        // Pad the previous frame up to the period, or catch up if it ran late.
+        if ((long)(this->_next - now) > 0) {
+            // Idle time, run the idle task while it has something to do and the time allows.
+            while (this->_idle && (long)(this->_next - now) > (long)idleMargin && this->_idle()) {
+                now = ::micros();
+            }
+            // delayMicroseconds is only accurate up to 16ms.
+            for (unsigned long left = (long)(this->_next - now) > 0 ? this->_next - now : 0; left;) {
+                const unsigned int d = left > 16000 ? 16000 : left;
+                ::delayMicroseconds(d);
+                left -= d;
+            }
+            now = this->_next;
+        } else if (now - this->_next > this->_period) {
+            this->_dropped += (now - this->_next) / this->_period;
+            this->_next = now;
+        }
+        this->_next += this->_period;
+
+        this->_board.prepare(cube);
+        const unsigned long shown = ::micros();
+        for (uint8_t z = 0; z < 8; z++) {
+            this->_board.showLayer(z);
+            ::delayMicroseconds(this->_onTime);
+        }
+        this->_board.blank();
+        const unsigned long end = ::micros();
+
+        // Shift outs happen while the previous layer is still lit, they add the same time to each layer.
+        this->_shiftTime = (end - shown - 8UL * this->_onTime) / 9;
+        this->schedule(shown - now);
+
+        this->countFrame(end);
+        this->_workStart = end;
+    }
+
+    // Task run in the padding between frames, e.g. printing the log. Setting one reserves idleReserve us
+    // of each frame for it, taken from the on-time. It is called repeatedly while it returns true and more
+    // than idleMargin us are left, so one call must take less than that.
+    void setIdle(bool (*idle)()) {
+        this->_idle = idle;
+    }
+
+    // Frames displayed during the last second.
+    uint16_t fps() const {
+        return this->_fps;
+    }
+
+    // Time each layer is lit, in us.
+    uint16_t onTime() const {
+        return this->_onTime;
+    }
+
+    // Frame slots skipped since the start because the loop ran late.
+    uint32_t framesDropped() const {
+        return this->_dropped;
+    }
+
+    // Peak time spent between frames running the effects, in us, to check against the work budget.
+    unsigned long workTime() const {
+        return this->_work;
+    }
+
+   private:
+    // Peak hold with a slow release.
+    void measureWork(unsigned long work) {
+        this->_work = work > this->_work ? work : this->_work - (this->_work >> 8);
+    }
+
+    void schedule(unsigned long prepareTime) {
+        const unsigned long busy = this->_workBudget + prepareTime + 9 * this->_shiftTime + (this->_idle ? idleReserve : 0);
+        const unsigned long onTime = busy + 8 * minOnTime < this->_period ? (this->_period - busy) / 8 : minOnTime;
+        this->_onTime = onTime;
+    }
+
+    void countFrame(unsigned long now) {
+        this->_frames++;
+        if (now - this->_second >= 1000000UL) {
+            this->_fps = this->_frames;
+            this->_frames = 0;
+            this->_second = now;
+        }
+    }
+
+   private:
+    static const uint16_t minOnTime = 50;
+    static const uint16_t idleReserve = 1000;
+    static const uint16_t idleMargin = 250;
+
+    const ILayerBoard& _board;
+    unsigned long _period;
+    unsigned long _workBudget;
+    bool (*_idle)() = 0;
+    bool _started = false;
+
+    uint16_t _onTime = minOnTime;
+    unsigned long _shiftTime = 0;
+    unsigned long _work = 0;
+    unsigned long _workStart = 0;
+    unsigned long _next = 0;
+
+    uint16_t _frames = 0;
+    uint16_t _fps = 0;
+    unsigned long _second = 0;
+    uint32_t _dropped = 0;
+};
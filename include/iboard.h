@@ -21,6 +21,25 @@ class IBoard {
         return cube.getVoxel(x, y, z);
     }
 
+    // Orient the rendered content, e.g. to match how the cube is installed.
+    virtual void setView(const View& view) {
+        this->_view = view;
+    }
+
+   protected:
+    // Cube to render: the given one, or the scratch one holding it reoriented by the view.
+    const ICubeRO& oriented(const ICubeRO& cube, Cube& scratch) const {
+        if (this->_view.isIdentity()) {
+            return cube;
+        }
+        Frame frame;
+        cube.read(frame);
+        this->_view.apply(frame);
+        scratch.write(frame);
+        return scratch;
+    }
+
    protected:
     voxelMapping _mapping = 0;
+    View _view;
 };
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "cube.h"
+#include "rng.h"
+
+class IEffect {
+   public:
+    // Effects are constructed in place in the effect arena, they get destroyed explicitly when switching.
+    virtual ~IEffect() {}
+
+    virtual void init(ICube& cube) {}
+
+    virtual bool ready(unsigned long currentTime) = 0;
+    virtual void step(ICube& cube) = 0;
+
+    virtual void loop(unsigned long currentTime, ICube& cube) {
+        if (this->ready(currentTime)) {
+            this->step(cube);
+        }
+    }
+
+    // Attach the random generator the effect draws from, usually owned by the effect runtime.
+    void attach(Rng& rng) {
+        this->_rng = &rng;
+    }
+
+   protected:
+    Rng& rng() {
+        return *this->_rng;
+    }
+
+   private:
+    Rng* _rng = &Rng::shared();
+};
+
+class BaseEffect : public IEffect {
+   public:
+    BaseEffect(unsigned int stepInterval) {
+        this->_interval = stepInterval;
+        this->_last = 0;
+    }
+
+    bool ready(unsigned long currentTime) {
+        if (currentTime - this->_last < (unsigned int)this->_interval) {
+            return false;
+        }
+        this->_last = currentTime;
+        return true;
+    }
+
+    virtual void step(ICube& cube) = 0;
+
+   private:
+    unsigned int _interval;
+    unsigned long _last;
+};
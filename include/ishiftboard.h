@@ -4,9 +4,41 @@
 
 #include "iboard.h"
 
+// ILayerBoard shows a cube one layer at a time: prepare serializes it, then each showLayer lights a
+// single layer. See Governor to give each layer the same on-time.
+class ILayerBoard : public IBoard {
+   public:
+    // Show the cube, each layer in turn. The last one stays lit until the next render.
+    void render(const ICubeRO& cube) const {
+        this->prepare(cube);
+        for (uint8_t z = 0; z < 8; z++) {
+            this->showLayer(z);
+        }
+    }
+
+    // Serialize the cube into the bytes shown for each layer.
+    virtual void prepare(const ICubeRO& cube) const = 0;
+    // Light the given layer of the prepared cube, alone.
+    virtual void showLayer(uint8_t z) const = 0;
+    // Turn all the layers off.
+    virtual void blank() const = 0;
+};
+
+// ILayerOutput receives a cube serialized once for several outputs, see FanOutBoard.
+class ILayerOutput {
+   public:
+    virtual void setup() const {}
+    // The frame about to be shown, e.g. to stream it whole. It is shared, valid until the next frame.
+    virtual void frame(const Frame& frame) const {}
+    // Light the layer z made of the given row bytes, in shift order.
+    virtual void showRows(uint8_t z, const uint8_t rows[8]) const {}
+    // Turn all the layers off.
+    virtual void blank() const {}
+};
+
 // IShiftBoard is an abstract class implementing most of the common shift register based board in LSB.
 // The actual shift() method needs to be implemented by the concrete class.
-class IShiftBoard : public IBoard {
+class IShiftBoard : public ILayerBoard, public ILayerOutput {
    public:
     IShiftBoard(int clockPin, int latchPin, int dataPin, int byteOrder = LSBFIRST) {
         this->_clockPin = clockPin;
@@ -21,22 +53,52 @@ class IShiftBoard : public IBoard {
         ::pinMode(this->_dataPin, OUTPUT);
     }
 
-    void render(const ICubeRO& cube) const {
-        for (int z = 0; z < 8; z++) {
-            this->latch();
+    // Serialize the cube into the bytes shifted for each layer.
+    virtual void prepare(const ICubeRO& in) const {
+        Cube scratch;
+        const ICubeRO& cube = this->oriented(in, scratch);
 
-            this->shift(0x01 << z);
+        // Without mapping the layers are shifted as stored.
+        if (!this->_mapping) {
+            for (int z = 0; z < 8; z++) {
+                const uint64_t layer = cube.getLayer(Plane::Z(z));
+                memcpy(this->_layers[z], &layer, 8);
+            }
+            return;
+        }
 
+        // The mapping goes voxel by voxel.
+        for (int z = 0; z < 8; z++) {
             for (int x = 0; x < 8; x++) {
                 uint8_t tmp = 0;
                 for (int y = 0; y < 8; y++) {
                     tmp |= this->getVoxel(cube, x, y, z) << y;
                 }
-                this->shift(tmp);
+                this->_layers[z][x] = tmp;
             }
+        }
+    }
 
-            this->unlatch();
+    virtual void showLayer(uint8_t z) const {
+        this->showRows(z, this->_layers[z]);
+    }
+
+    // Shift the layer select byte then the rows, as the fan out output of a single cube.
+    virtual void showRows(uint8_t z, const uint8_t rows[8]) const {
+        this->latch();
+        this->shift(0x01 << z);
+        for (uint8_t x = 0; x < 8; x++) {
+            this->shift(rows[x]);
         }
+        this->unlatch();
+    }
+
+    virtual void blank() const {
+        this->latch();
+        for (uint8_t i = 0; i < 9; i++) {
+            this->shift(0);
+        }
+        this->unlatch();
     }
 
     virtual void shift(uint8_t line) const = 0;
@@ -55,4 +117,7 @@ class IShiftBoard : public IBoard {
     int _latchPin;  // aka SS.
     int _dataPin;   // aka MOSI.
     int _byteOrder;
+
+   private:
+    mutable uint8_t _layers[8][8];
 };
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Logging that never blocks the loop.
+//
+// The LOG_* macros store a binary record in a RAM ring: the level, a pointer to the format string,
+// which stays in flash, and the integer arguments. Formatting and printing happen later, in the idle
+// time of the frames (see Governor::setIdle), one line at a time and only when the line fits in the
+// output buffer. When the ring is full the records are dropped and counted rather than waiting, until
+// the ring is printed and the number of dropped records with it.
+//
+// Levels below LOG_LEVEL are compiled out, arguments included.
+// Formats support %d, %u, %x, %c and %%, arguments are integers.
+// ex:
+//   LOG_INFO("Now using effect #%d", idx);
+
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_NONE 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Size of the record ring, a power of 2. A record takes 1 byte, a pointer and 4 bytes per argument.
+#ifndef LOG_RING_SIZE
+#ifdef __AVR__
+#define LOG_RING_SIZE 64
+#else
+#define LOG_RING_SIZE 512
+#endif
+#endif
+
+#define LOG_MAX_ARGS 4
+// Longest printed line, line ending included, longer ones are truncated. A line waits for the TX
+// buffer to take it whole: the Uno one has 64 bytes but reports 63 at most, and a line it can never
+// take would block the log.
+#define LOG_LINE_SIZE 62
+
+#if LOG_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(fmt, ...) logger.record(LOG_LEVEL_DEBUG, PSTR(fmt), ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(fmt, ...) \
+    do {                    \
+    } while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(fmt, ...) logger.record(LOG_LEVEL_INFO, PSTR(fmt), ##__VA_ARGS__)
+#else
+#define LOG_INFO(fmt, ...) \
+    do {                   \
+    } while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN(fmt, ...) logger.record(LOG_LEVEL_WARN, PSTR(fmt), ##__VA_ARGS__)
+#else
+#define LOG_WARN(fmt, ...) \
+    do {                   \
+    } while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(fmt, ...) logger.record(LOG_LEVEL_ERROR, PSTR(fmt), ##__VA_ARGS__)
+#else
+#define LOG_ERROR(fmt, ...) \
+    do {                    \
+    } while (0)
+#endif
+
+// Logger holds the ring of pending records. Not meant to be used from interrupts.
+class Logger {
+   public:
+    // Queue a record, use the LOG_* macros rather than calling it directly.
+    template <typename... Args>
+    void record(uint8_t level, const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "too many log arguments");
+        // Leading 0 so the array is never empty.
+        const int32_t values[] = {0, (int32_t)args...};
+        this->push(level, format, values + 1, sizeof...(Args));
+    }
+
+    // Print the oldest record if its line fits in what the output can take without blocking.
+    // Returns true when a line was printed, false when there is nothing to print or no room.
+    bool drain(Print& out);
+
+    // Whether records, or the report of dropped ones, wait to be printed.
+    bool pending() const {
+        return this->_head != this->_tail || this->_unreported;
+    }
+
+    // Records dropped because the ring was full, since the start.
+    uint32_t dropped() const {
+        return this->_dropped;
+    }
+
+   private:
+    void push(uint8_t level, const char* format, const int32_t* args, uint8_t count);
+
+    uint16_t used() const {
+        return (this->_head - this->_tail) & (LOG_RING_SIZE - 1);
+    }
+
+    void write(const void* data, uint8_t size);
+    void read(uint16_t at, void* data, uint8_t size) const;
+
+   private:
+    uint8_t _ring[LOG_RING_SIZE];
+    uint16_t _head = 0;
+    uint16_t _tail = 0;
+    uint32_t _dropped = 0;
+    // Drops not reported yet, printed before the next record.
+    uint16_t _unreported = 0;
+};
+
+extern Logger logger;
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Max number of effects with their own step time series, the others are not accounted.
+#ifndef METRICS_MAX_EFFECTS
+#define METRICS_MAX_EFFECTS 24
+#endif
+
+// Size of the buffer the metrics page is formatted into. The page takes up to 5.6KB with all the
+// METRICS_MAX_EFFECTS series and every counter at its max, lines past the end are dropped.
+#define METRICS_PAGE_SIZE 6144
+
+// Values sampled from the runtime when formatting the metrics page.
+struct MetricsGauges {
+    // Frames displayed during the last second and frames skipped as the loop ran late, see Governor.
+    uint16_t fps;
+    uint32_t framesDropped;
+    // Samples the audio input lost since it started, 0 when no effect streams audio.
+    uint32_t inputDropped;
+    // Active effect, see EffectCycler.
+    int effect;
+    // Free heap in bytes and its fragmentation in percent, 0 when unknown.
+    uint32_t freeHeap;
+    uint8_t heapFragmentation;
+    // WiFi signal in dBm, 0 when not connected.
+    int8_t rssi;
+};
+
+// Metrics accumulates the loop and effect timings exposed on /metrics, in the Prometheus text format.
+//
+// Recording is a few additions per loop. Formatting writes into a caller provided buffer with a fixed
+// number of lines, its cost is bounded whatever the uptime and it never allocates.
+class Metrics {
+   public:
+    // Time the given loop iteration spent outside of the frame display, i.e. what delays the next frame.
+    // Averages and max are over the last full second.
+    void loop(unsigned long now, unsigned long work) {
+        this->_loopSum += work;
+        this->_loopMax = work > this->_loopMax ? work : this->_loopMax;
+        this->_loops++;
+        if (now - this->_second >= 1000000UL) {
+            this->_loopAvgLast = this->_loops ? this->_loopSum / this->_loops : 0;
+            this->_loopMaxLast = this->_loopMax;
+            this->_loopSum = this->_loopMax = this->_loops = 0;
+            this->_second = now;
+        }
+    }
+
+    // Time the given effect spent in its loop call, its step when it was due.
+    void effect(int idx, unsigned long time) {
+        if (idx < 0 || idx >= METRICS_MAX_EFFECTS) {
+            return;
+        }
+        EffectTimes& e = this->_effects[idx];
+        e.total += time;
+        e.calls++;
+        e.max = time > e.max ? time : e.max;
+    }
+
+    // Format the page in the buffer, truncated to its size. Returns the length written.
+    size_t format(char* buf, size_t size, const MetricsGauges& gauges) const;
+
+   private:
+    struct EffectTimes {
+        uint32_t total;
+        uint32_t calls;
+        uint32_t max;
+    };
+
+    uint32_t _loopSum = 0;
+    uint32_t _loopMax = 0;
+    uint32_t _loops = 0;
+    uint32_t _loopAvgLast = 0;
+    uint32_t _loopMaxLast = 0;
+    unsigned long _second = 0;
+
+    EffectTimes _effects[METRICS_MAX_EFFECTS] = {};
+};
+
+// MetricsSender streams a formatted metrics page over the next loops, at most a chunk per call and only
+// what the connection takes without waiting, so a scrape doesn't stall the frames. The connection is a
+// WiFiClient on the board, a HostClient on the host: connected, availableForWrite and write.
+template <typename Client>
+class MetricsSender {
+   public:
+    // Most bytes of the page written per call.
+    static const size_t chunk = 512;
+
+    // True while a page is pending, another scrape has to wait.
+    bool busy() const {
+        return this->_sent < this->_length;
+    }
+
+    // Format the page for the given connection once the headers are out. Returns its length, 0 when busy.
+    size_t start(const Metrics& metrics, const MetricsGauges& gauges, const Client& client) {
+        if (this->busy()) {
+            return 0;
+        }
+        this->_length = metrics.format(this->_page, sizeof(this->_page), gauges);
+        this->_sent = 0;
+        this->_client = client;
+        return this->_length;
+    }
+
+    // Write what the connection takes of the pending page, called once per loop.
+    void send() {
+        if (!this->busy()) {
+            return;
+        }
+        if (!this->_client.connected()) {
+            this->_sent = this->_length;
+        } else {
+            size_t n = this->_length - this->_sent;
+            const size_t room = this->_client.availableForWrite();
+            n = n > room ? room : n;
+            n = n > MetricsSender::chunk ? MetricsSender::chunk : n;
+            if (n) {
+                this->_sent += this->_client.write((const uint8_t*)this->_page + this->_sent, n);
+            }
+        }
+        // Let go of the connection once done.
+        if (!this->busy()) {
+            this->_client = Client();
+        }
+    }
+
+   private:
+    char _page[METRICS_PAGE_SIZE];
+    size_t _length = 0;
+    size_t _sent = 0;
+    Client _client;
+};
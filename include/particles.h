@@ -0,0 +1,180 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "frame.h"
+#include "rng.h"
+
+// Particles use 8.8 fixed point numbers: 256 is one voxel, positions go from 0 to 8 * 256 excluded.
+typedef int16_t fixed;
+
+#define FIXED_ONE 256
+// Center of the given voxel coordinate.
+#define FIXED_VOXEL(i) ((fixed)((i)*FIXED_ONE + FIXED_ONE / 2))
+
+// ParticlePool holds up to Capacity particles as structure of arrays, one array per component,
+// so the update loops stream through each component.
+template <uint8_t Capacity>
+class ParticlePool {
+   public:
+    // What happens to particles reaching a wall of the cube.
+    enum walls {
+        // Removed from the pool.
+        kill,
+        // Stopped against the wall.
+        stop,
+        // Bounced back, losing speed based on the restitution.
+        bounce,
+    };
+
+    ParticlePool(walls mode = walls::kill) : _walls(mode) {}
+
+    // Constant acceleration applied each step, in 8.8 fixed point voxels per step^2.
+    void setGravity(fixed x, fixed y, fixed z) {
+        this->_gravity[0] = x;
+        this->_gravity[1] = y;
+        this->_gravity[2] = z;
+    }
+
+    // Speed kept when bouncing, 256 for a perfectly elastic bounce.
+    void setRestitution(uint16_t restitution) {
+        this->_restitution = restitution;
+    }
+
+    // Add a particle, ignored when the pool is full.
+    // A life of 0 makes the particle live until it leaves the cube.
+    bool emit(fixed x, fixed y, fixed z, fixed vx, fixed vy, fixed vz, uint8_t life = 0) {
+        if (this->_size >= Capacity) {
+            return false;
+        }
+        const uint8_t i = this->_size++;
+        this->_pos[0][i] = x;
+        this->_pos[1][i] = y;
+        this->_pos[2][i] = z;
+        this->_vel[0][i] = vx;
+        this->_vel[1][i] = vy;
+        this->_vel[2][i] = vz;
+        this->_life[i] = life;
+        return true;
+    }
+
+    uint8_t size() const {
+        return this->_size;
+    }
+
+    bool full() const {
+        return this->_size >= Capacity;
+    }
+
+    void clear() {
+        this->_size = 0;
+    }
+
+    // Voxel coordinate of the given particle along the given axis (0: x, 1: y, 2: z).
+    int voxel(uint8_t i, uint8_t axis) const {
+        return this->_pos[axis][i] >> 8;
+    }
+
+    fixed velocity(uint8_t i, uint8_t axis) const {
+        return this->_vel[axis][i];
+    }
+
+    // Move all the particles by one step, then age them and handle the walls.
+    void update() {
+        for (uint8_t axis = 0; axis < 3; axis++) {
+            fixed* pos = this->_pos[axis];
+            fixed* vel = this->_vel[axis];
+            const fixed gravity = this->_gravity[axis];
+            for (uint8_t i = 0; i < this->_size; i++) {
+                vel[i] += gravity;
+                pos[i] += vel[i];
+            }
+        }
+
+        // Dead particles get replaced by the last one.
+        for (uint8_t i = 0; i < this->_size;) {
+            if ((this->_life[i] && --this->_life[i] == 0) || !this->collide(i)) {
+                this->remove(i);
+                continue;
+            }
+            i++;
+        }
+    }
+
+    // Set the voxel of each particle in the frame.
+    void render(Frame& frame) const {
+        for (uint8_t i = 0; i < this->_size; i++) {
+            frame.rows[this->_pos[2][i] >> 8][this->_pos[0][i] >> 8] |= 1 << (this->_pos[1][i] >> 8);
+        }
+    }
+
+   private:
+    // Keep the given particle within the cube, returns false if it needs to be removed.
+    bool collide(uint8_t i) {
+        for (uint8_t axis = 0; axis < 3; axis++) {
+            fixed& pos = this->_pos[axis][i];
+            if (pos >= 0 && pos < 8 * FIXED_ONE) {
+                continue;
+            }
+            switch (this->_walls) {
+                case walls::kill:
+                    return false;
+                case walls::bounce:
+                    this->_vel[axis][i] = -(fixed)(((int32_t)this->_vel[axis][i] * this->_restitution) >> 8);
+                    break;
+                case walls::stop:
+                default:
+                    this->_vel[axis][i] = 0;
+                    break;
+            }
+            pos = pos < 0 ? 0 : 8 * FIXED_ONE - 1;
+        }
+        return true;
+    }
+
+    void remove(uint8_t i) {
+        const uint8_t last = --this->_size;
+        for (uint8_t axis = 0; axis < 3; axis++) {
+            this->_pos[axis][i] = this->_pos[axis][last];
+            this->_vel[axis][i] = this->_vel[axis][last];
+        }
+        this->_life[i] = this->_life[last];
+    }
+
+   private:
+    fixed _pos[3][Capacity];
+    fixed _vel[3][Capacity];
+    uint8_t _life[Capacity];
+    uint8_t _size = 0;
+
+    walls _walls;
+    fixed _gravity[3] = {0, 0, 0};
+    uint16_t _restitution = FIXED_ONE / 2;
+};
+
+// Emitter spawns particles within a box, with a base velocity plus a random spread.
+struct Emitter {
+    // Corner of the box and its size, the particles are spread within [origin, origin + extent).
+    fixed origin[3];
+    fixed extent[3];
+    // Base velocity, a random value within [-spread, spread) is added to each component.
+    fixed velocity[3];
+    fixed spread;
+    // Life of the particles, 0 to live until they leave the cube.
+    uint8_t life;
+
+    // Spawn up to count particles, returns how many were added.
+    template <uint8_t Capacity>
+    uint8_t emit(ParticlePool<Capacity>& pool, Rng& rng, uint8_t count) const {
+        uint8_t n = 0;
+        for (; n < count && !pool.full(); n++) {
+            fixed p[3], v[3];
+            for (uint8_t axis = 0; axis < 3; axis++) {
+                p[axis] = this->origin[axis] + (this->extent[axis] ? rng.below(this->extent[axis]) : 0);
+                v[axis] = this->velocity[axis] + (this->spread ? (fixed)rng.below(2 * this->spread) - this->spread : 0);
+            }
+            pool.emit(p[0], p[1], p[2], v[0], v[1], v[2], this->life);
+        }
+        return n;
+    }
+};
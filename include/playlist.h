@@ -0,0 +1,14 @@
+#pragma once
+
+#include "effectregistry.h"
+
+// Registry of the effects played by the cube, shared by the firmware and the host tools.
+extern EffectRegistry registry;
+
+// Index of the bytecode effect receiving the uploaded programs.
+extern const int bytecodeEffect;
+
+// The registered effects and the arena size they need, to build more registries over the same effects.
+extern const EffectEntry* const playlist;
+extern const int playlistSize;
+extern const size_t playlistArenaSize;
@@ -0,0 +1,16 @@
+#pragma once
+
+// Generated by `ledcube asm programs/planeboing.lcasm include/programs/planeboing.h planeboingProgram`, do not edit.
+
+#include <Arduino.h>
+
+static const uint8_t planeboingProgram[] PROGMEM = {
+    0x4c, 0x56, 0x01, 0x64, 0x00, 0x00, 0x00, 0x10, 0x00, 0x4b, 0x00, 0x01,
+    0x01, 0x04, 0x00, 0x01, 0x01, 0x04, 0x02, 0x03, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x20, 0x00, 0x03, 0x00, 0x03, 0x02, 0x0b, 0x21, 0x03, 0x01, 0x03,
+    0x02, 0x09, 0x05, 0x04, 0x01, 0x01, 0x07, 0x14, 0x19, 0x2a, 0x00, 0x03,
+    0x02, 0x12, 0x04, 0x02, 0x00, 0x03, 0x01, 0x01, 0x00, 0x14, 0x18, 0x4a,
+    0x00, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x03, 0x00, 0x01,
+    0x03, 0x0c, 0x01, 0x01, 0x09, 0x05, 0x04, 0x00, 0x01, 0x00, 0x01, 0x01,
+    0x20, 0x00, 0x35,
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+// Generated by `ledcube asm programs/rain.lcasm include/programs/rain.h rainProgram`, do not edit.
+
+#include <Arduino.h>
+
+static const uint8_t rainProgram[] PROGMEM = {
+    0x4c, 0x56, 0x01, 0x64, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01,
+    0xfd, 0x21, 0x01, 0x05, 0x1b, 0x05, 0x04, 0x00, 0x18, 0x1b, 0x00, 0x01,
+    0x08, 0x1b, 0x01, 0x08, 0x1b, 0x01, 0x07, 0x01, 0x01, 0x1c, 0x1a, 0x00,
+    0x0c, 0x00, 0x00, 0x4f,
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stdint.h>
+
+// Rng is a small xorshift32 pseudo random generator, much cheaper than Arduino's random() on AVR,
+// which runs a 32 bits LCG followed by a 32 bits modulo for each draw.
+// Sequences are fully determined by the seed, making runs reproducible.
+class Rng {
+   public:
+    constexpr Rng(uint32_t seed = 0x92d68ca2) : _state(seed ? seed : 0x92d68ca2), _bits(0), _available(0) {}
+
+    // Shared instance, used by effects not attached to a runtime.
+    static Rng& shared() {
+        static Rng rng;
+        return rng;
+    }
+
+    // Reset the sequence. The seed is mixed so close seeds (i.e. analogRead noise) give unrelated sequences.
+    void seed(uint32_t seed) {
+        seed ^= seed >> 16;
+        seed *= 0x7feb352d;
+        seed ^= seed >> 15;
+        seed *= 0x846ca68b;
+        seed ^= seed >> 16;
+        // xorshift gets stuck on 0.
+        this->_state = seed ? seed : 0x92d68ca2;
+        this->_available = 0;
+    }
+
+    // Next 32 random bits.
+    uint32_t next() {
+        uint32_t x = this->_state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return this->_state = x;
+    }
+
+    // Random number in [0, bound), bound up to 65535.
+    // Uses a multiply-shift on the upper bits instead of a division.
+    uint16_t below(uint16_t bound) {
+        return ((uint32_t)(uint16_t)(this->next() >> 16) * bound) >> 16;
+    }
+
+    // Random number in [min, max), similar to Arduino's random(min, max).
+    int range(int min, int max) {
+        return min + this->below(max - min);
+    }
+
+    // Up to 8 random bits, taken from a cached 32 bits draw.
+    // ex: rng.bits(3) is a random coordinate within the cube.
+    uint8_t bits(uint8_t count) {
+        if (this->_available < count) {
+            this->_bits = this->next();
+            this->_available = 32;
+        }
+        uint8_t out = this->_bits & ((1 << count) - 1);
+        this->_bits >>= count;
+        this->_available -= count;
+        return out;
+    }
+
+    // Random boolean.
+    bool coin() {
+        return this->bits(1);
+    }
+
+    // 64 random bits at once, one per voxel of a layer.
+    uint64_t bits64() {
+        // The high half first, in sequence: the order of the calls within an expression is unspecified.
+        const uint32_t high = this->next();
+        const uint32_t low = this->next();
+        return (uint64_t)high << 32 | low;
+    }
+
+   private:
+    uint32_t _state;
+    uint32_t _bits;
+    uint8_t _available;
+};
@@ -6,6 +6,6 @@ class ShiftPulseBoard : public IShiftBoard {
     // Inherit the base constructor.
     using IShiftBoard::IShiftBoard;
 
-   private:
+   protected:
     void shift(uint8_t line) const;
 };
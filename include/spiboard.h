@@ -9,7 +9,7 @@ class SPIBoard : public IShiftBoard {
     SPIBoard(int clockPin, int latchPin, int dataPin, int byteOrder = LSBFIRST, uint32_t speed = 800000, int mode = SPI_MODE0);
     void setup() const;
 
-   private:
+   protected:
     void shift(uint8_t line) const;
 
    private:
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "cube.h"
+#include "ieffect.h"
+
+// Bytecode effects: small stack based programs run by the Bytecode effect, loaded at runtime over
+// Serial or HTTP, see ProgramLoader, and produced by the host assembler (`ledcube asm`).
+//
+// Program image, as sent to the loaders, little endian:
+//   "LV" magic, 1 byte version.
+//   uint16 step interval in ms, uint16 init entry, uint16 step entry, uint16 code size.
+//   The code.
+//   1 byte checksum, sum of all the previous bytes.
+//
+// The stack holds 16 bits values and wraps around after 16 entries, 16 variables keep their value
+// across steps. Coordinates are taken modulo 8, axes are 1 (x), 2 (y) or 3 (z), negated for the
+// negative direction. Running off the end of the code or executing halt ends the section.
+
+#define VM_VERSION 1
+#define VM_HEADER_SIZE 11
+#define VM_STACK_SIZE 16
+#define VM_VARIABLES 16
+
+// Max code size, the program lives in the effect arena.
+#ifndef VM_PROGRAM_SIZE
+#ifdef __AVR__
+#define VM_PROGRAM_SIZE 512
+#else
+#define VM_PROGRAM_SIZE 2048
+#endif
+#endif
+
+// Jumps allowed per section run, stops runaway loops from freezing the cube.
+#define VM_JUMP_BUDGET 2000
+
+// Operand kinds.
+#define VM_NONE 0
+#define VM_I8 1
+#define VM_I16 2
+#define VM_VAR 3
+#define VM_ADDR 4
+#define VM_VAR_ADDR 5
+
+// Instruction set: identifier, assembler mnemonic, operand kind.
+#define VM_OPS(OP)                \
+    OP(halt, "halt", VM_NONE)     \
+    OP(push8, "push8", VM_I8)     \
+    OP(push16, "push16", VM_I16)  \
+    OP(load, "load", VM_VAR)      \
+    OP(store, "store", VM_VAR)    \
+    OP(dup, "dup", VM_NONE)       \
+    OP(drop, "drop", VM_NONE)     \
+    OP(swap, "swap", VM_NONE)     \
+    OP(over, "over", VM_NONE)     \
+    OP(add, "add", VM_NONE)       \
+    OP(sub, "sub", VM_NONE)       \
+    OP(mul, "mul", VM_NONE)       \
+    OP(mod, "mod", VM_NONE)       \
+    OP(band, "and", VM_NONE)      \
+    OP(bor, "or", VM_NONE)        \
+    OP(bxor, "xor", VM_NONE)      \
+    OP(shl, "shl", VM_NONE)       \
+    OP(shr, "shr", VM_NONE)       \
+    OP(neg, "neg", VM_NONE)       \
+    OP(lnot, "not", VM_NONE)      \
+    OP(lt, "lt", VM_NONE)         \
+    OP(gt, "gt", VM_NONE)         \
+    OP(eq, "eq", VM_NONE)         \
+    OP(jmp, "jmp", VM_ADDR)       \
+    OP(jz, "jz", VM_ADDR)         \
+    OP(jnz, "jnz", VM_ADDR)       \
+    OP(loop, "loop", VM_VAR_ADDR) \
+    OP(rand, "rand", VM_NONE)     \
+    OP(set, "set", VM_NONE)       \
+    OP(get, "get", VM_NONE)       \
+    OP(row, "row", VM_NONE)       \
+    OP(setrow, "setrow", VM_NONE) \
+    OP(fill, "fill", VM_NONE)     \
+    OP(shift, "shift", VM_NONE)   \
+    OP(clear, "clear", VM_NONE)
+
+// Opcodes.
+//   halt                    end of the section.
+//   push8 i / push16 i      ( -- i)
+//   load v / store v        ( -- var) / (a -- ) into var.
+//   dup, drop, swap, over   (a -- a a), (a -- ), (a b -- b a), (a b -- a b a)
+//   add ... eq              (a b -- a op b), comparisons give 0 or 1, mod by 0 gives 0.
+//   neg, not                (a -- -a), (a -- !a)
+//   jmp addr, jz/jnz addr   jump, pop and jump if zero/non zero.
+//   loop v addr             decrement var, jump while it is non zero.
+//   rand                    (n -- random in [0, n))
+//   set, get                (x y z value -- ), (x y z -- value)
+//   row, setrow             (x z -- bits), (x z bits -- ): the 8 voxels along y at once.
+//   fill                    (axis offset value -- ) fill a plane.
+//   shift                   (axis -- ) shift the cube along the axis, signed for the direction.
+//   clear                   clear the cube.
+enum vmOp {
+#define VM_ENUM(name, mnemonic, operands) vm_##name,
+    VM_OPS(VM_ENUM)
+#undef VM_ENUM
+        vm_count,
+};
+
+// Number of operand bytes of the given operand kind.
+inline uint8_t vmOperandSize(uint8_t kind) {
+    return kind == VM_NONE ? 0 : kind == VM_I8 || kind == VM_VAR ? 1 : kind == VM_VAR_ADDR ? 3 : 2;
+}
+
+// Operand kind of the given opcode.
+uint8_t vmOperands(uint8_t op);
+
+// Decoded program header.
+struct VmHeader {
+    uint16_t interval;
+    uint16_t init;
+    uint16_t step;
+    uint16_t size;
+
+    // Parse the header bytes, false if they are not a program header.
+    bool parse(const uint8_t bytes[VM_HEADER_SIZE]);
+};
+
+// Bytecode runs a loaded program: its init section when activated, its step section every interval.
+// It starts with the given program image stored in flash, if any, until another one gets loaded.
+// The program lives in the effect, it is lost when switching to another effect.
+class Bytecode : public IEffect {
+   public:
+    Bytecode(const uint8_t* image = 0);
+
+    // Storage for the code, written by the loaders before calling start.
+    // The current program stops as it is about to be overwritten.
+    uint8_t* slot() {
+        this->_valid = false;
+        return this->_code;
+    }
+
+    // Check the code in the slot and run it from now on, shows nothing if it is invalid.
+    bool start(const VmHeader& header);
+
+    void init(ICube& cube) {
+        if (this->_valid) {
+            this->run(cube, this->_header.init);
+        }
+    }
+
+    bool ready(unsigned long currentTime) {
+        if (!this->_valid || currentTime - this->_last < this->_header.interval) {
+            return false;
+        }
+        this->_last = currentTime;
+        return true;
+    }
+
+    void step(ICube& cube) {
+        this->run(cube, this->_header.step);
+    }
+
+   private:
+    void run(ICube& cube, uint16_t pc);
+
+   private:
+    VmHeader _header;
+    bool _valid = false;
+    unsigned long _last = 0;
+    int16_t _vars[VM_VARIABLES];
+    // Code plus a trailing halt.
+    uint8_t _code[VM_PROGRAM_SIZE + 1];
+};
+
+// ProgramLoader receives a program image byte by byte, e.g. from Serial, and loads it into the
+// Bytecode effect returned by the target callback once the header is received.
+// Garbage before the magic is skipped, a transfer stalled for more than 1s is dropped.
+class ProgramLoader {
+   public:
+    typedef Bytecode* (*target)();
+
+    enum status {
+        idle,
+        loading,
+        done,
+        failed,
+    };
+
+    ProgramLoader(target target) : _target(target) {}
+
+    status feed(uint8_t b, unsigned long currentTime);
+
+   private:
+    target _target;
+    Bytecode* _vm = 0;
+    VmHeader _header;
+    uint8_t _bytes[VM_HEADER_SIZE];
+    uint16_t _pos = 0;
+    uint8_t _sum = 0;
+    unsigned long _last = 0;
+};
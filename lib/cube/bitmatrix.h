@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Kernels on 8x8 bit matrices stored as 8 row bytes, bit j of byte i being the element (i, j).
+// They work on two 32 bits words (little endian) rather than one 64 bits word as 64 bits shifts are
+// library calls on AVR.
+
+// transpose8 swaps rows and columns of the matrix.
+inline void transpose8(uint8_t m[8]) {
+    uint32_t lo, hi, t;
+    memcpy(&lo, m, 4);
+    memcpy(&hi, m + 4, 4);
+
+    // Swap the 1x1 blocks of each 2x2 block.
+    t = (lo ^ (lo >> 7)) & 0x00aa00aa;
+    lo ^= t ^ (t << 7);
+    t = (hi ^ (hi >> 7)) & 0x00aa00aa;
+    hi ^= t ^ (t << 7);
+
+    // Swap the 2x2 blocks of each 4x4 block.
+    t = (lo ^ (lo >> 14)) & 0x0000cccc;
+    lo ^= t ^ (t << 14);
+    t = (hi ^ (hi >> 14)) & 0x0000cccc;
+    hi ^= t ^ (t << 14);
+
+    // Swap the top right and bottom left 4x4 blocks.
+    t = (lo ^ (hi << 4)) & 0xf0f0f0f0;
+    lo ^= t;
+    hi ^= t >> 4;
+
+    memcpy(m, &lo, 4);
+    memcpy(m + 4, &hi, 4);
+}
+
+// reverseColumns mirrors the matrix horizontally (bit j <-> bit 7 - j of each row).
+inline void reverseColumns(uint8_t m[8]) {
+    for (int i = 0; i < 8; i += 4) {
+        uint32_t w;
+        memcpy(&w, m + i, 4);
+        w = ((w >> 4) & 0x0f0f0f0f) | ((w & 0x0f0f0f0f) << 4);
+        w = ((w >> 2) & 0x33333333) | ((w & 0x33333333) << 2);
+        w = ((w >> 1) & 0x55555555) | ((w & 0x55555555) << 1);
+        memcpy(m + i, &w, 4);
+    }
+}
+
+// reverseRows mirrors the matrix vertically (row i <-> row 7 - i).
+inline void reverseRows(uint8_t m[8]) {
+    for (int i = 0; i < 4; i++) {
+        uint8_t t = m[i];
+        m[i] = m[7 - i];
+        m[7 - i] = t;
+    }
+}
+
+// reverseBits mirrors a single row (bit j <-> bit 7 - j).
+inline uint8_t reverseBits(uint8_t b) {
+    b = (b >> 4) | (b << 4);
+    b = ((b >> 2) & 0x33) | ((b & 0x33) << 2);
+    return ((b >> 1) & 0x55) | ((b & 0x55) << 1);
+}
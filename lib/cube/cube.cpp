@@ -5,52 +5,150 @@ Cube::Cube() {
 }
 
 void Cube::setVoxel(int x, int y, int z, int value) {
-    this->_state[x][y][z] = value ? 1 : 0;
+    this->_state.set(x, y, z, value);
 }
 
 void Cube::setVoxel(const Plane& p, int i, int j, int value) {
-    Plane::axis axis = p;
-    int offset = p;
-
-    this->setVoxel(
-        axis == Plane::axis::x ? offset : i,
-        axis == Plane::axis::y ? offset : j,
-        axis == Plane::axis::z ? offset : axis == Plane::axis::x ? i : j,
-        value);
+    const coords c = planeVoxel(p, i, j);
+    this->setVoxel(c.x, c.y, c.z, value);
 }
 
 int Cube::getVoxel(int x, int y, int z) const {
-    return this->_state[x][y][z];
+    return this->_state.get(x, y, z);
 }
 
-int& Cube::getVoxelRef(const coords& c) {
-    return this->_state[c.x][c.y][c.z];
+int Cube::getVoxel(const Plane& p, int i, int j) const {
+    const coords c = planeVoxel(p, i, j);
+    return this->getVoxel(c.x, c.y, c.z);
 }
 
-int Cube::getVoxel(const Plane& p, int i, int j) const {
-    Plane::axis axis = p;
-    int offset = p;
+uint8_t Cube::getRow(Plane::axis axis, int i, int j) const {
+    uint8_t row = 0;
+    switch (axis) {
+        case Plane::axis::x:
+            // Bit y of each row of the layer z.
+            for (int x = 0; x < 8; x++) {
+                row |= ((this->_state.rows[i][x] >> j) & 1) << x;
+            }
+            break;
+        case Plane::axis::y:
+            row = this->_state.rows[j][i];
+            break;
+        case Plane::axis::z:
+            // Bit y of the row x of each layer.
+            for (int z = 0; z < 8; z++) {
+                row |= ((this->_state.rows[z][i] >> j) & 1) << z;
+            }
+            break;
+    }
+    return row;
+}
+
+void Cube::setRow(Plane::axis axis, int i, int j, uint8_t row) {
+    const uint8_t mask = 1 << j;
+    switch (axis) {
+        case Plane::axis::x:
+            for (int x = 0; x < 8; x++) {
+                uint8_t& r = this->_state.rows[i][x];
+                r = (r & ~mask) | (((row >> x) & 1) << j);
+            }
+            break;
+        case Plane::axis::y:
+            this->_state.rows[j][i] = row;
+            break;
+        case Plane::axis::z:
+            for (int z = 0; z < 8; z++) {
+                uint8_t& r = this->_state.rows[z][i];
+                r = (r & ~mask) | (((row >> z) & 1) << j);
+            }
+            break;
+    }
+}
 
-    return this->getVoxel(
-        axis == Plane::axis::x ? offset : i,
-        axis == Plane::axis::y ? offset : j,
-        axis == Plane::axis::z ? offset : axis == Plane::axis::x ? i : j);
+uint64_t Cube::getLayer(const Plane& p) const {
+    const int offset = p;
+    uint8_t bytes[8];
+    switch ((Plane::axis)p) {
+        case Plane::axis::x:
+            // Byte z, bit y: the row x of each layer.
+            for (int z = 0; z < 8; z++) {
+                bytes[z] = this->_state.rows[z][offset];
+            }
+            break;
+        case Plane::axis::y:
+            // Byte x, bit z: the columns through y.
+            for (int x = 0; x < 8; x++) {
+                bytes[x] = this->getRow(Plane::axis::z, x, offset);
+            }
+            break;
+        case Plane::axis::z:
+        default:
+            memcpy(bytes, this->_state.rows[offset], 8);
+            break;
+    }
+    uint64_t layer;
+    memcpy(&layer, bytes, 8);
+    return layer;
+}
+
+void Cube::setLayer(const Plane& p, uint64_t layer) {
+    const int offset = p;
+    uint8_t bytes[8];
+    memcpy(bytes, &layer, 8);
+    switch ((Plane::axis)p) {
+        case Plane::axis::x:
+            for (int z = 0; z < 8; z++) {
+                this->_state.rows[z][offset] = bytes[z];
+            }
+            break;
+        case Plane::axis::y:
+            for (int x = 0; x < 8; x++) {
+                this->setRow(Plane::axis::z, x, offset, bytes[x]);
+            }
+            break;
+        case Plane::axis::z:
+        default:
+            memcpy(this->_state.rows[offset], bytes, 8);
+            break;
+    }
+}
+
+void Cube::read(Frame& frame) const {
+    frame = this->_state;
+}
+
+void Cube::write(const Frame& frame) {
+    this->_state = frame;
 }
 
 void Cube::fill(const Plane& p, int value) {
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            this->setVoxel(p, i, j, value);
-        }
+    const uint8_t row = value ? 0xff : 0;
+    const int offset = p;
+
+    switch ((Plane::axis)p) {
+        case Plane::axis::x:
+            for (int z = 0; z < 8; z++) {
+                this->_state.rows[z][offset] = row;
+            }
+            break;
+        case Plane::axis::y:
+            for (int z = 0; z < 8; z++) {
+                for (int x = 0; x < 8; x++) {
+                    this->_state.set(x, offset, z, value);
+                }
+            }
+            break;
+        case Plane::axis::z:
+            memset(this->_state.rows[offset], row, 8);
+            break;
     }
 }
 
 void Cube::clear() {
-    for (int z = 0; z < 8; z++) {
-        this->fill(Plane::Z(z), 0);
-    }
+    this->_state.clear();
 }
 
+// Moves the layers by one along the plane direction, the rows being packed this is a byte move or a bit shift.
 void Cube::shift(const Plane& p) {
     if (p == Plane::direction::stale) {
         return;
@@ -58,14 +156,41 @@ void Cube::shift(const Plane& p) {
 
     const Plane::direction direction = p;
 
-    for (int k = direction < 0 ? 0 : 7; (direction < 0 && k < 7) || (direction > 0 && k > 0); k -= direction) {
-        for (int i = 0; i < 8; i++) {
-            for (int j = 0; j < 8; j++) {
-                this->setVoxel(p(k), i, j, this->getVoxel(p(k - direction), i, j));
+    switch ((Plane::axis)p) {
+        case Plane::axis::x:
+            for (int z = 0; z < 8; z++) {
+                if (direction > 0) {
+                    memmove(&this->_state.rows[z][1], &this->_state.rows[z][0], 7);
+                } else {
+                    memmove(&this->_state.rows[z][0], &this->_state.rows[z][1], 7);
+                }
+            }
+            break;
+        case Plane::axis::y:
+            for (int z = 0; z < 8; z++) {
+                for (int x = 0; x < 8; x++) {
+                    if (direction > 0) {
+                        this->_state.rows[z][x] <<= 1;
+                    } else {
+                        this->_state.rows[z][x] >>= 1;
+                    }
+                }
             }
-        }
+            // The bit shift already cleared out the first/last layer.
+            return;
+        case Plane::axis::z:
+            if (direction > 0) {
+                memmove(this->_state.rows[1], this->_state.rows[0], 7 * 8);
+            } else {
+                memmove(this->_state.rows[0], this->_state.rows[1], 7 * 8);
+            }
+            break;
     }
 
     // Clear out the first/last layer.
     this->fill(p(direction < 0 ? 7 : 0), 0);
 }
+
+void Cube::transform(const View& view) {
+    view.apply(this->_state);
+}
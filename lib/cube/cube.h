@@ -1,28 +1,93 @@
 #pragma once
 
+#include "frame.h"
 #include "plane.h"
+#include "view.h"
 
 struct coords {
     coords(unsigned int _x, unsigned int _y, unsigned int _z) : x(_x), y(_y), z(_z) {}
 
-    unsigned int& x;
-    unsigned int& y;
-    unsigned int& z;
-
-    coords& operator=(const coords& in) {
-        this->x = in.x;
-        this->y = in.y;
-        this->z = in.z;
-        return *this;
-    }
+    unsigned int x;
+    unsigned int y;
+    unsigned int z;
 };
 
+// Coordinates of the voxel i, j of the given plane: (z, y) on X planes, (x, z) on Y planes, (x, y) on Z planes.
+inline coords planeVoxel(const Plane& p, int i, int j) {
+    const Plane::axis axis = p;
+    const int offset = p;
+
+    return coords(
+        axis == Plane::axis::x ? offset : i,
+        axis == Plane::axis::y ? offset : j,
+        axis == Plane::axis::z ? offset : axis == Plane::axis::x ? i : j);
+}
+
 class ICubeRO {
    public:
     // Get a specific voxel.
     virtual int getVoxel(int x, int y, int z) const = 0;
     // Get the i,j voxel from the given plane.
     virtual int getVoxel(const Plane& p, int i, int j) const { return -1; }
+
+    // Get the voxels along y at the given x, z, bit y being the voxel (x, y, z).
+    virtual uint8_t getRow(int x, int z) const {
+        uint8_t row = 0;
+        for (int y = 0; y < 8; y++) {
+            row |= (this->getVoxel(x, y, z) ? 1 : 0) << y;
+        }
+        return row;
+    }
+
+    // Get the voxels along the given axis through the voxel i, j of its planes, bit k being the voxel at k.
+    // ex: getRow(Plane::z, x, y) is the column at x, y, getRow(Plane::y, x, z) is getRow(x, z).
+    virtual uint8_t getRow(Plane::axis axis, int i, int j) const {
+        if (axis == Plane::axis::y) {
+            return this->getRow(i, j);
+        }
+        uint8_t row = 0;
+        for (int k = 0; k < 8; k++) {
+            const coords c = planeVoxel(Plane(axis, k), i, j);
+            row |= (this->getVoxel(c.x, c.y, c.z) ? 1 : 0) << k;
+        }
+        return row;
+    }
+
+    // Get the layer at the given plane, bit 8 * i + j being its voxel i, j, see planeVoxel.
+    // Z layers are laid out as in a frame: byte x, bit y.
+    virtual uint64_t getLayer(const Plane& p) const {
+        uint8_t bytes[8];
+        for (int i = 0; i < 8; i++) {
+            uint8_t b = 0;
+            for (int j = 0; j < 8; j++) {
+                const coords c = planeVoxel(p, i, j);
+                b |= (this->getVoxel(c.x, c.y, c.z) ? 1 : 0) << j;
+            }
+            bytes[i] = b;
+        }
+        uint64_t layer;
+        memcpy(&layer, bytes, 8);
+        return layer;
+    }
+
+    // Copy the full cube out as a packed frame.
+    // Default goes voxel by voxel, cubes with a packed backing store should override it.
+    virtual void read(Frame& frame) const {
+        for (int z = 0; z < 8; z++) {
+            for (int x = 0; x < 8; x++) {
+                uint8_t row = 0;
+                for (int y = 0; y < 8; y++) {
+                    row |= (this->getVoxel(x, y, z) ? 1 : 0) << y;
+                }
+                frame.rows[z][x] = row;
+            }
+        }
+    }
+
+    // Number of 8x8x8 segments side by side along x, for volumes made of several chained cubes.
+    virtual int segments() const { return 1; }
+    // Copy the given segment out as a packed frame.
+    virtual void readSegment(int i, Frame& frame) const { this->read(frame); }
 };
 
 class ICubeWO {
@@ -32,8 +97,35 @@ class ICubeWO {
     // Set the i,j voxel from the given plane.
     virtual void setVoxel(const Plane& p, int i, int j, int value) {}
 
-    // Get a mutable voxel.
-    virtual int& getVoxelRef(const coords&) = 0;
+    // Set the voxels along y at the given x, z, see ICubeRO::getRow.
+    virtual void setRow(int x, int z, uint8_t row) {
+        for (int y = 0; y < 8; y++) {
+            this->setVoxel(x, y, z, (row >> y) & 1);
+        }
+    }
+
+    // Set the voxels along the given axis, see ICubeRO::getRow(Plane::axis, int, int).
+    virtual void setRow(Plane::axis axis, int i, int j, uint8_t row) {
+        if (axis == Plane::axis::y) {
+            return this->setRow(i, j, row);
+        }
+        for (int k = 0; k < 8; k++) {
+            const coords c = planeVoxel(Plane(axis, k), i, j);
+            this->setVoxel(c.x, c.y, c.z, (row >> k) & 1);
+        }
+    }
+
+    // Set the layer at the given plane, see ICubeRO::getLayer.
+    virtual void setLayer(const Plane& p, uint64_t layer) {
+        uint8_t bytes[8];
+        memcpy(bytes, &layer, 8);
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                const coords c = planeVoxel(p, i, j);
+                this->setVoxel(c.x, c.y, c.z, (bytes[i] >> j) & 1);
+            }
+        }
+    }
 
     // Clear the full cube.
     virtual void clear(){};
@@ -42,45 +134,130 @@ class ICubeWO {
     // Fill a single plane layer with the given value.
     virtual void fill(const Plane& p, int value){};
 
+    // Copy a packed frame in, replacing the full cube.
+    // Default goes voxel by voxel, cubes with a packed backing store should override it.
+    virtual void write(const Frame& frame) {
+        for (int z = 0; z < 8; z++) {
+            for (int x = 0; x < 8; x++) {
+                for (int y = 0; y < 8; y++) {
+                    this->setVoxel(x, y, z, frame.get(x, y, z));
+                }
+            }
+        }
+    }
+};
+
+class ICube;
+template <typename E>
+struct CubeExpr;
+
+// VoxelRef is a mutable reference to a single voxel, usable whatever the backing store of the cube.
+class VoxelRef {
+   public:
+    VoxelRef(ICube& cube, const coords& c) : _cube(cube), _c(c) {}
+
+    operator int() const;
+    VoxelRef& operator=(int value);
+    VoxelRef& operator=(const VoxelRef& other) { return *this = (int)other; }
+
+   private:
+    ICube& _cube;
+    coords _c;
+};
+
+class ICube : public ICubeRO, public ICubeWO {
+   public:
+    // Reorient the full cube.
+    // Default goes through a packed frame, cubes with a packed backing store should transform it in place.
+    virtual void transform(const View& view) {
+        Frame frame;
+        this->read(frame);
+        view.apply(frame);
+        this->write(frame);
+    }
+
+    // Evaluate a cube expression into the cube in a single pass, see expr.h.
+    // ex: cube = box(0, 0, 0, 3, 3, 3) & ~sphere(0, 0, 0, 6);
+    template <typename E>
+    ICube& operator=(const CubeExpr<E>& e);
+    template <typename E>
+    ICube& operator|=(const CubeExpr<E>& e);
+    template <typename E>
+    ICube& operator&=(const CubeExpr<E>& e);
+    template <typename E>
+    ICube& operator^=(const CubeExpr<E>& e);
+
+    // Get a mutable voxel.
+    VoxelRef getVoxelRef(const coords& c) {
+        return VoxelRef(*this, c);
+    }
+
     struct proxy {
         struct subproxy {
             subproxy(const proxy& p, int y = -1) : _p(p), _y(y) {}
-            int& operator[](unsigned int idx) { return this->_p._cube.getVoxelRef({this->_p._x, this->_y, idx}); }
+            VoxelRef operator[](unsigned int idx) { return this->_p._cube.getVoxelRef({this->_p._x, this->_y, idx}); }
             const proxy& _p;
             unsigned int _y;
         };
 
-        proxy(ICubeWO& cube, int x = -1) : _cube(cube), _x(x) {}
+        proxy(ICube& cube, int x = -1) : _cube(cube), _x(x) {}
         subproxy operator[](unsigned int idx) { return subproxy(*this, idx); }
-        ICubeWO& _cube;
+        ICube& _cube;
         unsigned int _x;
     };
 
     // ex: cube[0][0][7] = 1;
     proxy operator[](unsigned int idx) { return proxy(*this, idx); }
     // ex: cube[{0, 0, 7}] = 1;
-    int& operator[](const coords& c) { return this->getVoxelRef(c); }
+    VoxelRef operator[](const coords& c) { return this->getVoxelRef(c); }
 };
 
-class ICube : public ICubeRO, public ICubeWO {
-};
+inline VoxelRef::operator int() const {
+    return this->_cube.getVoxel(this->_c.x, this->_c.y, this->_c.z);
+}
+
+inline VoxelRef& VoxelRef::operator=(int value) {
+    this->_cube.setVoxel(this->_c.x, this->_c.y, this->_c.z, value);
+    return *this;
+}
 
+// Cube stores the voxels packed, one bit each, see Frame.
 class Cube : public ICube {
    public:
     Cube();
 
+    using ICube::operator=;
+
     void setVoxel(int x, int y, int z, int value);
     void setVoxel(const Plane& p, int i, int j, int value);
 
     int getVoxel(int x, int y, int z) const;
     int getVoxel(const Plane& p, int i, int j) const;
-    int& getVoxelRef(const coords& c);
+
+    uint8_t getRow(int x, int z) const {
+        return this->_state.rows[z][x];
+    }
+
+    void setRow(int x, int z, uint8_t row) {
+        this->_state.rows[z][x] = row;
+    }
+
+    uint8_t getRow(Plane::axis axis, int i, int j) const;
+    void setRow(Plane::axis axis, int i, int j, uint8_t row);
+
+    uint64_t getLayer(const Plane& p) const;
+    void setLayer(const Plane& p, uint64_t layer);
+
+    void read(Frame& frame) const;
+    void write(const Frame& frame);
 
     void clear();
 
     void shift(const Plane& p);
     void fill(const Plane& p, int value);
 
+    void transform(const View& view);
+
    private:
-    int _state[8][8][8];
+    Frame _state;
 };
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "cube.h"
+
+// CubeChain is a volume made of Segments cubes side by side along x, 8 * Segments voxels wide.
+// Effects can either draw on the chain as one wide volume or on each segment as an independent cube.
+// Frame copies and transforms are per segment: read/write address the first segment, transform
+// reorients each segment in place.
+template <uint8_t Segments>
+class CubeChain : public ICube {
+   public:
+    static const int width = 8 * Segments;
+
+    using ICube::operator=;
+
+    Cube& segment(uint8_t i) {
+        return this->_segments[i];
+    }
+
+    const Cube& segment(uint8_t i) const {
+        return this->_segments[i];
+    }
+
+    int segments() const {
+        return Segments;
+    }
+
+    void readSegment(int i, Frame& frame) const {
+        this->_segments[i].read(frame);
+    }
+
+    int getVoxel(int x, int y, int z) const {
+        return this->_segments[x >> 3].getVoxel(x & 7, y, z);
+    }
+
+    void setVoxel(int x, int y, int z, int value) {
+        this->_segments[x >> 3].setVoxel(x & 7, y, z, value);
+    }
+
+    uint8_t getRow(int x, int z) const {
+        return this->_segments[x >> 3].getRow(x & 7, z);
+    }
+
+    void setRow(int x, int z, uint8_t row) {
+        this->_segments[x >> 3].setRow(x & 7, z, row);
+    }
+
+    int getVoxel(const Plane& p, int i, int j) const {
+        const coords c = planeVoxel(p, i, j);
+        return this->getVoxel(c.x, c.y, c.z);
+    }
+
+    void setVoxel(const Plane& p, int i, int j, int value) {
+        const coords c = planeVoxel(p, i, j);
+        this->setVoxel(c.x, c.y, c.z, value);
+    }
+
+    // Rows along x and Y or Z layers are 8 voxels wide, like read/write they address the first segment.
+    // Rows along y or z and X layers anywhere in the chain.
+    uint8_t getRow(Plane::axis axis, int i, int j) const {
+        if (axis == Plane::axis::x) {
+            return this->_segments[0].getRow(axis, i, j);
+        }
+        return this->_segments[i >> 3].getRow(axis, i & 7, j);
+    }
+
+    void setRow(Plane::axis axis, int i, int j, uint8_t row) {
+        if (axis == Plane::axis::x) {
+            return this->_segments[0].setRow(axis, i, j, row);
+        }
+        this->_segments[i >> 3].setRow(axis, i & 7, j, row);
+    }
+
+    uint64_t getLayer(const Plane& p) const {
+        if (p == Plane::axis::x) {
+            const int offset = p;
+            return this->_segments[offset >> 3].getLayer(p(offset & 7));
+        }
+        return this->_segments[0].getLayer(p);
+    }
+
+    void setLayer(const Plane& p, uint64_t layer) {
+        if (p == Plane::axis::x) {
+            const int offset = p;
+            return this->_segments[offset >> 3].setLayer(p(offset & 7), layer);
+        }
+        this->_segments[0].setLayer(p, layer);
+    }
+
+    void read(Frame& frame) const {
+        this->_segments[0].read(frame);
+    }
+
+    void write(const Frame& frame) {
+        this->_segments[0].write(frame);
+    }
+
+    void clear() {
+        for (uint8_t s = 0; s < Segments; s++) {
+            this->_segments[s].clear();
+        }
+    }
+
+    // X planes are relative to the whole chain, Y and Z planes span all the segments.
+    void fill(const Plane& p, int value) {
+        if (p == Plane::axis::x) {
+            const int offset = p;
+            this->_segments[offset >> 3].fill(p(offset & 7), value);
+            return;
+        }
+        for (uint8_t s = 0; s < Segments; s++) {
+            this->_segments[s].fill(p, value);
+        }
+    }
+
+    // Along x, the layer leaving a segment enters the next one.
+    void shift(const Plane& p) {
+        if (p != Plane::axis::x || p == Plane::direction::stale) {
+            for (uint8_t s = 0; s < Segments; s++) {
+                this->_segments[s].shift(p);
+            }
+            return;
+        }
+
+        // Rows moving in from the previous segment, zeros for the first one.
+        const bool positive = (Plane::direction)p > 0;
+        const int in = positive ? 0 : 7;
+        uint8_t carry[8] = {0};
+        for (uint8_t i = 0; i < Segments; i++) {
+            Cube& segment = this->_segments[positive ? i : Segments - 1 - i];
+            Frame frame;
+            segment.read(frame);
+            for (int z = 0; z < 8; z++) {
+                const uint8_t out = frame.rows[z][7 - in];
+                if (positive) {
+                    memmove(&frame.rows[z][1], &frame.rows[z][0], 7);
+                } else {
+                    memmove(&frame.rows[z][0], &frame.rows[z][1], 7);
+                }
+                frame.rows[z][in] = carry[z];
+                carry[z] = out;
+            }
+            segment.write(frame);
+        }
+    }
+
+    void transform(const View& view) {
+        for (uint8_t s = 0; s < Segments; s++) {
+            this->_segments[s].transform(view);
+        }
+    }
+
+   private:
+    Cube _segments[Segments];
+};
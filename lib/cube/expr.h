@@ -0,0 +1,356 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "bitmatrix.h"
+#include "cube.h"
+
+// Cube expressions combine shapes, cubes and frames with bitwise operators, lazily:
+//   cube = (box(0, 0, 0, 3, 3, 3) | sphere(7, 7, 7, 6)) & ~mask;
+//   cube ^= transform(View::rotate(Plane::z), other);
+// Nothing is computed until the expression is assigned to a cube. Each of the 64 rows (see Frame) is
+// then computed once through the whole expression, shapes generating their rows on the fly, without
+// any intermediate frame.
+//
+// Expressions hold references to the cubes and frames they read, they are meant to be assigned right away.
+
+template <typename E>
+struct CubeExpr {
+    // Voxels along y at x, z, bit y being the voxel (x, y, z), as in Frame.
+    uint8_t row(int x, int z) const {
+        return static_cast<const E&>(*this).row(x, z);
+    }
+};
+
+// Bits from..to of a row, both included, clipped to the cube.
+inline uint8_t rowSpan(int from, int to) {
+    from = from < 0 ? 0 : from;
+    to = to > 7 ? 7 : to;
+    if (from > to) {
+        return 0;
+    }
+    return (uint8_t)(0xff << from) & (uint8_t)(0xff >> (7 - to));
+}
+
+// Rows of a frame.
+class FrameRows : public CubeExpr<FrameRows> {
+   public:
+    FrameRows(const Frame& frame) : _frame(frame) {}
+
+    uint8_t row(int x, int z) const {
+        return this->_frame.rows[z][x];
+    }
+
+   private:
+    const Frame& _frame;
+};
+
+// Rows of a packed cube, read without going through the interface.
+class PackedRows : public CubeExpr<PackedRows> {
+   public:
+    PackedRows(const Cube& cube) : _cube(cube) {}
+
+    uint8_t row(int x, int z) const {
+        return this->_cube.Cube::getRow(x, z);
+    }
+
+   private:
+    const Cube& _cube;
+};
+
+// Rows of any cube, through ICubeRO::getRow.
+class CubeRows : public CubeExpr<CubeRows> {
+   public:
+    CubeRows(const ICubeRO& cube) : _cube(cube) {}
+
+    uint8_t row(int x, int z) const {
+        return this->_cube.getRow(x, z);
+    }
+
+   private:
+    const ICubeRO& _cube;
+};
+
+// Expression reading the given cube, frame or expression, to use a cube where only expressions are taken.
+// ex:
+//   cube ^= rows(other);
+template <typename E>
+E rows(const CubeExpr<E>& e) {
+    return static_cast<const E&>(e);
+}
+
+inline FrameRows rows(const Frame& frame) {
+    return FrameRows(frame);
+}
+
+inline PackedRows rows(const Cube& cube) {
+    return PackedRows(cube);
+}
+
+inline CubeRows rows(const ICubeRO& cube) {
+    return CubeRows(cube);
+}
+
+// Layer at the given plane.
+class LayerShape : public CubeExpr<LayerShape> {
+   public:
+    LayerShape(const Plane& p) : _axis(p), _offset(p) {}
+
+    uint8_t row(int x, int z) const {
+        switch (this->_axis) {
+            case Plane::axis::x:
+                return x == this->_offset ? 0xff : 0;
+            case Plane::axis::y:
+                return rowSpan(this->_offset, this->_offset);
+            default:
+                return z == this->_offset ? 0xff : 0;
+        }
+    }
+
+   private:
+    Plane::axis _axis;
+    int _offset;
+};
+
+inline LayerShape layer(const Plane& p) {
+    return LayerShape(p);
+}
+
+// Filled box between the two given corners, both included.
+class BoxShape : public CubeExpr<BoxShape> {
+   public:
+    BoxShape(int x0, int y0, int z0, int x1, int y1, int z1) : _x0(x0), _z0(z0), _x1(x1), _z1(z1), _row(rowSpan(y0, y1)) {}
+
+    uint8_t row(int x, int z) const {
+        return x >= this->_x0 && x <= this->_x1 && z >= this->_z0 && z <= this->_z1 ? this->_row : 0;
+    }
+
+   private:
+    int _x0, _z0, _x1, _z1;
+    uint8_t _row;
+};
+
+inline BoxShape box(int x0, int y0, int z0, int x1, int y1, int z1) {
+    return BoxShape(x0, y0, z0, x1, y1, z1);
+}
+
+// The 12 edges of the box between the two given corners, both included.
+class EdgesShape : public CubeExpr<EdgesShape> {
+   public:
+    EdgesShape(int x0, int y0, int z0, int x1, int y1, int z1)
+        : _x0(x0), _z0(z0), _x1(x1), _z1(z1), _full(rowSpan(y0, y1)), _ends(rowSpan(y0, y0) | rowSpan(y1, y1)) {
+        if (y0 > y1) {
+            this->_ends = 0;
+        }
+    }
+
+    uint8_t row(int x, int z) const {
+        if (x < this->_x0 || x > this->_x1 || z < this->_z0 || z > this->_z1) {
+            return 0;
+        }
+        const bool xEdge = x == this->_x0 || x == this->_x1;
+        const bool zEdge = z == this->_z0 || z == this->_z1;
+        // Rows along the vertical edges are full, the others only cross the top and bottom edges.
+        return xEdge && zEdge ? this->_full : xEdge || zEdge ? this->_ends : 0;
+    }
+
+   private:
+    int _x0, _z0, _x1, _z1;
+    uint8_t _full;
+    uint8_t _ends;
+};
+
+inline EdgesShape edges(int x0, int y0, int z0, int x1, int y1, int z1) {
+    return EdgesShape(x0, y0, z0, x1, y1, z1);
+}
+
+// Filled sphere, center and radius in half voxels so it can be centered between voxels.
+// ex:
+//   sphere(7, 7, 7, 8); // Largest sphere centered in the cube.
+class SphereShape : public CubeExpr<SphereShape> {
+   public:
+    SphereShape(int cx, int cy, int cz, int r) : _cx(cx), _cy(cy), _cz(cz), _r2(r * r) {}
+
+    uint8_t row(int x, int z) const {
+        const int dx = 2 * x - this->_cx;
+        const int dz = 2 * z - this->_cz;
+        const int rest = this->_r2 - dx * dx - dz * dz;
+        if (rest < 0) {
+            return 0;
+        }
+        // Voxels with |2y - cy| <= h.
+        const int h = isqrt(rest);
+        return rowSpan(halfCeil(this->_cy - h), halfFloor(this->_cy + h));
+    }
+
+   private:
+    static int isqrt(int v) {
+        int r = 0;
+        for (int b = 1 << 7; b; b >>= 1) {
+            if ((r + b) * (r + b) <= v) {
+                r += b;
+            }
+        }
+        return r;
+    }
+
+    static int halfFloor(int v) {
+        return v >= 0 ? v / 2 : -((1 - v) / 2);
+    }
+
+    static int halfCeil(int v) {
+        return halfFloor(v + 1);
+    }
+
+   private:
+    int _cx, _cy, _cz;
+    int _r2;
+};
+
+inline SphereShape sphere(int cx, int cy, int cz, int r) {
+    return SphereShape(cx, cy, cz, r);
+}
+
+// Two expressions combined row by row. The operators take any expression, cube or frame, see rows.
+template <typename A, typename B, typename Op>
+class BinaryExpr : public CubeExpr<BinaryExpr<A, B, Op>> {
+   public:
+    BinaryExpr(const A& a, const B& b) : _a(a), _b(b) {}
+
+    uint8_t row(int x, int z) const {
+        return Op::apply(this->_a.row(x, z), this->_b.row(x, z));
+    }
+
+   private:
+    A _a;
+    B _b;
+};
+
+struct OrOp {
+    static uint8_t apply(uint8_t a, uint8_t b) { return a | b; }
+};
+
+struct AndOp {
+    static uint8_t apply(uint8_t a, uint8_t b) { return a & b; }
+};
+
+struct XorOp {
+    static uint8_t apply(uint8_t a, uint8_t b) { return a ^ b; }
+};
+
+template <typename A, typename B>
+auto operator|(const A& a, const B& b) -> BinaryExpr<decltype(rows(a)), decltype(rows(b)), OrOp> {
+    return BinaryExpr<decltype(rows(a)), decltype(rows(b)), OrOp>(rows(a), rows(b));
+}
+
+template <typename A, typename B>
+auto operator&(const A& a, const B& b) -> BinaryExpr<decltype(rows(a)), decltype(rows(b)), AndOp> {
+    return BinaryExpr<decltype(rows(a)), decltype(rows(b)), AndOp>(rows(a), rows(b));
+}
+
+template <typename A, typename B>
+auto operator^(const A& a, const B& b) -> BinaryExpr<decltype(rows(a)), decltype(rows(b)), XorOp> {
+    return BinaryExpr<decltype(rows(a)), decltype(rows(b)), XorOp>(rows(a), rows(b));
+}
+
+template <typename A>
+class NotExpr : public CubeExpr<NotExpr<A>> {
+   public:
+    NotExpr(const A& a) : _a(a) {}
+
+    uint8_t row(int x, int z) const {
+        return ~this->_a.row(x, z);
+    }
+
+   private:
+    A _a;
+};
+
+template <typename A>
+auto operator~(const A& a) -> NotExpr<decltype(rows(a))> {
+    return NotExpr<decltype(rows(a))>(rows(a));
+}
+
+// Expression seen through the given view, see View.
+template <typename A>
+class TransformExpr : public CubeExpr<TransformExpr<A>> {
+   public:
+    TransformExpr(const View& view, const A& a) : _view(view), _a(a) {}
+
+    uint8_t row(int x, int z) const {
+        int p[3];
+        if (this->_view.source(1) == 1) {
+            // Rows stay rows, possibly reversed.
+            this->_view.sourceVoxel(x, 0, z, p);
+            const uint8_t row = this->_a.row(p[0], p[2]);
+            return this->_view.mirrored(1) ? reverseBits(row) : row;
+        }
+        // Rows come across the source rows, gather them bit by bit.
+        uint8_t row = 0;
+        for (int y = 0; y < 8; y++) {
+            this->_view.sourceVoxel(x, y, z, p);
+            row |= ((this->_a.row(p[0], p[2]) >> p[1]) & 1) << y;
+        }
+        return row;
+    }
+
+   private:
+    View _view;
+    A _a;
+};
+
+template <typename A>
+auto transform(const View& view, const A& a) -> TransformExpr<decltype(rows(a))> {
+    return TransformExpr<decltype(rows(a))>(view, rows(a));
+}
+
+// Evaluate the expression row by row into the frame, combined with the current rows by Op.
+template <typename Op, typename E>
+void evalRows(Frame& frame, const CubeExpr<E>& e) {
+    for (int z = 0; z < 8; z++) {
+        for (int x = 0; x < 8; x++) {
+            frame.rows[z][x] = Op::apply(frame.rows[z][x], e.row(x, z));
+        }
+    }
+}
+
+// Replacing the cube.
+struct AssignOp {
+    static uint8_t apply(uint8_t, uint8_t b) { return b; }
+};
+
+// The expression may read the cube itself, it is evaluated in full before the cube is written.
+template <typename E>
+ICube& ICube::operator=(const CubeExpr<E>& e) {
+    Frame frame;
+    evalRows<AssignOp>(frame, e);
+    this->write(frame);
+    return *this;
+}
+
+template <typename E>
+ICube& ICube::operator|=(const CubeExpr<E>& e) {
+    Frame frame;
+    this->read(frame);
+    evalRows<OrOp>(frame, e);
+    this->write(frame);
+    return *this;
+}
+
+template <typename E>
+ICube& ICube::operator&=(const CubeExpr<E>& e) {
+    Frame frame;
+    this->read(frame);
+    evalRows<AndOp>(frame, e);
+    this->write(frame);
+    return *this;
+}
+
+template <typename E>
+ICube& ICube::operator^=(const CubeExpr<E>& e) {
+    Frame frame;
+    this->read(frame);
+    evalRows<XorOp>(frame, e);
+    this->write(frame);
+    return *this;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Frame is a packed snapshot of the cube, one bit per voxel, 64 bytes.
+// rows[z][x] holds the voxels along y, y being the bit index.
+// Each z layer is 8 contiguous bytes, i.e. the byte stream of a shift register board layer.
+struct Frame {
+    uint8_t rows[8][8];
+
+    int get(int x, int y, int z) const {
+        return (this->rows[z][x] >> y) & 1;
+    }
+
+    void set(int x, int y, int z, int value) {
+        if (value) {
+            this->rows[z][x] |= 1 << y;
+        } else {
+            this->rows[z][x] &= ~(1 << y);
+        }
+    }
+
+    void clear() {
+        memset(this->rows, 0, sizeof(this->rows));
+    }
+
+    // FNV-1a hash of the voxels, e.g. to detect repeating frames.
+    uint32_t hash() const {
+        uint32_t h = 2166136261UL;
+        for (int i = 0; i < 64; i++) {
+            h = (h ^ this->rows[i >> 3][i & 7]) * 16777619UL;
+        }
+        return h;
+    }
+
+    bool operator==(const Frame& other) const {
+        return memcmp(this->rows, other.rows, sizeof(this->rows)) == 0;
+    }
+
+    bool operator!=(const Frame& other) const {
+        return !(*this == other);
+    }
+};
@@ -0,0 +1,101 @@
+#include "life.h"
+
+// Bit-sliced counts of a layer, for the two words of 4 rows: 0 to 9 cells within the 3x3 square in
+// the layer centered on each cell, itself included.
+struct LayerCounts {
+    uint32_t slices[2][4];
+};
+
+// Add the bit-sliced numbers a and b of n slices each into out, n + 1 slices.
+static inline void addSlices(const uint32_t* a, const uint32_t* b, uint32_t* out, int n) {
+    uint32_t carry = 0;
+    for (int i = 0; i < n; i++) {
+        const uint32_t s = a[i] ^ b[i];
+        const uint32_t c = (a[i] & b[i]) | (carry & s);
+        out[i] = s ^ carry;
+        carry = c;
+    }
+    out[n] = carry;
+}
+
+static void layerCounts(const Frame& frame, int z, bool wrap, LayerCounts& counts) {
+    uint32_t w[2];
+    memcpy(w, frame.rows[z], 8);
+
+    // Sum along y: each cell plus its y - 1 and y + 1 neighbours, 2 slices.
+    uint32_t y[2][2];
+    for (int h = 0; h < 2; h++) {
+        const uint32_t up = ((w[h] << 1) & 0xfefefefe) | (wrap ? (w[h] >> 7) & 0x01010101 : 0);
+        const uint32_t down = ((w[h] >> 1) & 0x7f7f7f7f) | (wrap ? (w[h] << 7) & 0x80808080 : 0);
+        y[h][0] = up ^ w[h] ^ down;
+        y[h][1] = (up & w[h]) | (down & (up ^ w[h]));
+    }
+
+    // Sum along x: the rows being bytes, the x - 1 and x + 1 neighbours are the sums one byte away.
+    for (int h = 0; h < 2; h++) {
+        const int o = 1 - h;
+        uint32_t left[2], right[2], lr[3];
+        for (int i = 0; i < 2; i++) {
+            left[i] = (y[h][i] << 8) | (h || wrap ? y[o][i] >> 24 : 0);
+            right[i] = (y[h][i] >> 8) | (!h || wrap ? y[o][i] << 24 : 0);
+        }
+        addSlices(left, right, lr, 2);
+        const uint32_t center[3] = {y[h][0], y[h][1], 0};
+        addSlices(lr, center, counts.slices[h], 3);
+    }
+}
+
+// Cells of the word whose count is in the given set.
+static inline uint32_t match(const uint32_t count[5], uint32_t set) {
+    uint32_t m = 0;
+    for (uint8_t n = 0; set; n++, set >>= 1) {
+        if (!(set & 1)) {
+            continue;
+        }
+        uint32_t t = 0xffffffff;
+        for (int i = 0; i < 5; i++) {
+            t &= (n >> i) & 1 ? count[i] : ~count[i];
+        }
+        m |= t;
+    }
+    return m;
+}
+
+void lifeStep(const Frame& in, Frame& out, const LifeRule& rule, bool wrap) {
+    // The counts include the cell itself, so a live cell survives with n neighbours on a count of n + 1.
+    const uint32_t survive = rule.survive << 1;
+
+    // Rolling window over the layers, the first one is kept for the wrap around of the last one.
+    LayerCounts first, prev, cur, next;
+    const LayerCounts dead = {};
+    layerCounts(in, 0, wrap, first);
+    cur = first;
+    if (wrap) {
+        layerCounts(in, 7, wrap, prev);
+    } else {
+        prev = dead;
+    }
+
+    for (int z = 0; z < 8; z++) {
+        if (z < 7) {
+            layerCounts(in, z + 1, wrap, next);
+        } else {
+            next = wrap ? first : dead;
+        }
+
+        uint32_t alive[2];
+        memcpy(alive, in.rows[z], 8);
+        for (int h = 0; h < 2; h++) {
+            // Up to 27 cells, 5 slices.
+            uint32_t pc[5], count[6];
+            addSlices(prev.slices[h], cur.slices[h], pc, 4);
+            const uint32_t n[5] = {next.slices[h][0], next.slices[h][1], next.slices[h][2], next.slices[h][3], 0};
+            addSlices(pc, n, count, 5);
+            alive[h] = (alive[h] & match(count, survive)) | (~alive[h] & match(count, rule.birth));
+        }
+        memcpy(out.rows[z], alive, 8);
+
+        prev = cur;
+        cur = next;
+    }
+}
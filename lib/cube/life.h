@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "frame.h"
+
+// LifeRule is a 3D life-like rule over the 26 neighbours of a cell.
+struct LifeRule {
+    // Bit n set: a live cell with n live neighbours survives.
+    uint32_t survive;
+    // Bit n set: a dead cell with n live neighbours comes to life.
+    uint32_t birth;
+
+    // Rule in Bays' notation: survive with [el, eu] neighbours, birth with [fl, fu].
+    // ex: LifeRule::bays(4, 5, 5, 5) for 4555.
+    static constexpr LifeRule bays(uint8_t el, uint8_t eu, uint8_t fl, uint8_t fu) {
+        return {range(el, eu), range(fl, fu)};
+    }
+
+    static constexpr uint32_t range(uint8_t lo, uint8_t hi) {
+        return ((2UL << hi) - 1) & ~((1UL << lo) - 1);
+    }
+};
+
+// lifeStep computes the next generation of the given frame. With wrap, the cube is a torus, otherwise
+// the cells outside of the cube are dead. in and out may be the same frame.
+//
+// The neighbour counts are bit-sliced: 32 cells (4 rows) are counted at once with full adders on
+// 32 bits words, slice i holding bit i of the count of each cell.
+void lifeStep(const Frame& in, Frame& out, const LifeRule& rule, bool wrap);
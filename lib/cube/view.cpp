@@ -0,0 +1,142 @@
+#include "view.h"
+
+#include "bitmatrix.h"
+
+// Swap the displayed axes a < b of the frame.
+static void swapAxes(Frame& frame, int a, int b) {
+    if (a == 0 && b == 1) {
+        // x <-> y: transpose each z layer.
+        for (int z = 0; z < 8; z++) {
+            transpose8(frame.rows[z]);
+        }
+    } else if (a == 0 && b == 2) {
+        // x <-> z: the rows only move, transpose the byte matrix.
+        for (int z = 0; z < 8; z++) {
+            for (int x = z + 1; x < 8; x++) {
+                uint8_t t = frame.rows[z][x];
+                frame.rows[z][x] = frame.rows[x][z];
+                frame.rows[x][z] = t;
+            }
+        }
+    } else {
+        // y <-> z: transpose the (z, y) matrix of each x slice.
+        for (int x = 0; x < 8; x++) {
+            uint8_t m[8];
+            for (int z = 0; z < 8; z++) {
+                m[z] = frame.rows[z][x];
+            }
+            transpose8(m);
+            for (int z = 0; z < 8; z++) {
+                frame.rows[z][x] = m[z];
+            }
+        }
+    }
+}
+
+View View::rotate(Plane::axis axis, int quarterTurns) {
+    // Axes u and v in direct order around the rotation axis.
+    int u = axis % 3;
+    int v = (axis + 1) % 3;
+
+    View quarter;
+    // Displayed (u, v) comes from (v, 7 - u).
+    quarter._axes[u] = v;
+    quarter._axes[v] = u;
+    quarter._mirror = 1 << u;
+
+    View view;
+    for (int i = ((quarterTurns % 4) + 4) % 4; i > 0; i--) {
+        view = view.then(quarter);
+    }
+    return view;
+}
+
+View View::mirror(Plane::axis axis) {
+    View view;
+    view._mirror = 1 << (axis - 1);
+    return view;
+}
+
+View View::swap(Plane::axis a, Plane::axis b) {
+    View view;
+    view._axes[a - 1] = b - 1;
+    view._axes[b - 1] = a - 1;
+    return view;
+}
+
+View View::align(const Plane& from, const Plane& to) {
+    const int fromAxis = (Plane::axis)from - 1;
+    const int toAxis = (Plane::axis)to - 1;
+    const int sign = (Plane::direction)from * (Plane::direction)to;
+
+    // Look for the rotation among the 24 of them.
+    for (int a = 0; a < 4; a++) {
+        for (int b = 0; b < 4; b++) {
+            for (int c = 0; c < 4; c++) {
+                View view = rotate(Plane::x, a).then(rotate(Plane::y, b)).then(rotate(Plane::z, c));
+                // Moving along a source axis moves along the displayed axis using it, reversed when mirrored.
+                if (view._axes[toAxis] == fromAxis && (view._mirror & (1 << toAxis) ? -1 : 1) == sign) {
+                    return view;
+                }
+            }
+        }
+    }
+    return View();
+}
+
+View View::then(const View& next) const {
+    // Displayed o comes from p = next(o), which comes from this(p).
+    View view;
+    view._mirror = 0;
+    for (int i = 0; i < 3; i++) {
+        view._axes[i] = this->_axes[next._axes[i]];
+        view._mirror |= (((next._mirror >> i) ^ (this->_mirror >> next._axes[i])) & 1) << i;
+    }
+    return view;
+}
+
+View View::inverse() const {
+    View view;
+    view._mirror = 0;
+    for (int i = 0; i < 3; i++) {
+        view._axes[this->_axes[i]] = i;
+        view._mirror |= ((this->_mirror >> i) & 1) << this->_axes[i];
+    }
+    return view;
+}
+
+void View::apply(Frame& frame) const {
+    // Permute the axes with up to 2 swaps, tracking the source axis of each displayed axis.
+    uint8_t current[3] = {0, 1, 2};
+    for (int i = 0; i < 3; i++) {
+        if (current[i] == this->_axes[i]) {
+            continue;
+        }
+        int j = i + 1;
+        while (current[j] != this->_axes[i]) {
+            j++;
+        }
+        swapAxes(frame, i, j);
+        current[j] = current[i];
+        current[i] = this->_axes[i];
+    }
+
+    if (this->_mirror & 1) {
+        for (int z = 0; z < 8; z++) {
+            reverseRows(frame.rows[z]);
+        }
+    }
+    if (this->_mirror & 2) {
+        for (int z = 0; z < 8; z++) {
+            reverseColumns(frame.rows[z]);
+        }
+    }
+    if (this->_mirror & 4) {
+        for (int z = 0; z < 4; z++) {
+            uint8_t t[8];
+            memcpy(t, frame.rows[z], 8);
+            memcpy(frame.rows[z], frame.rows[7 - z], 8);
+            memcpy(frame.rows[7 - z], t, 8);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "frame.h"
+#include "plane.h"
+
+// View is one of the 48 orientations of the cube: rotations, mirrors, axis swaps and their combinations.
+// It is an axis permutation followed by mirrors, applied on packed frames with 8x8 bit matrix kernels.
+//
+// Each displayed voxel o comes from the source voxel p where, for each axis i,
+// p[source(i)] = o[i], or 7 - o[i] when the axis i is mirrored.
+class View {
+   public:
+    View() : _axes{0, 1, 2}, _mirror(0) {}
+
+    // Quarter turns around the given axis, counter clockwise when looking from the positive side.
+    // ex:
+    //   View::rotate(Plane::z).apply(frame); // (0, 0, 0) is now displayed at (7, 0, 0).
+    static View rotate(Plane::axis axis, int quarterTurns = 1);
+
+    // Mirror along the given axis.
+    static View mirror(Plane::axis axis);
+
+    // Swap the two given axes.
+    static View swap(Plane::axis a, Plane::axis b);
+
+    // Rotation displaying the direction of the `from` plane along the direction of the `to` plane.
+    // ex:
+    //   // Rain falls along -Z, show it falling along +X.
+    //   View v = View::align(-Plane::Z, +Plane::X);
+    static View align(const Plane& from, const Plane& to);
+
+    // Combined view, applying this view first then the given one.
+    View then(const View& next) const;
+
+    // View undoing this one.
+    View inverse() const;
+
+    bool isIdentity() const {
+        return this->_axes[0] == 0 && this->_axes[1] == 1 && this->_axes[2] == 2 && this->_mirror == 0;
+    }
+
+    // Transform the given frame in place.
+    void apply(Frame& frame) const;
+
+    // Source axis (0: x, 1: y, 2: z) of the displayed axis i, and whether it is mirrored.
+    uint8_t source(int i) const {
+        return this->_axes[i];
+    }
+
+    bool mirrored(int i) const {
+        return (this->_mirror >> i) & 1;
+    }
+
+    // Source voxel p of the displayed voxel x, y, z, to transform voxel by voxel.
+    void sourceVoxel(int x, int y, int z, int p[3]) const {
+        const int o[3] = {x, y, z};
+        for (int i = 0; i < 3; i++) {
+            p[this->_axes[i]] = this->mirrored(i) ? 7 - o[i] : o[i];
+        }
+    }
+
+   private:
+    // Source axis (0: x, 1: y, 2: z) of each displayed axis.
+    uint8_t _axes[3];
+    // Bit i set when the displayed axis i is mirrored.
+    uint8_t _mirror;
+};
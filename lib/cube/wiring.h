@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "bitmatrix.h"
+#include "frame.h"
+
+// Wiring describes the byte stream a controller expects for a layer: which frame row goes in which
+// shifted byte, which bytes have their bits reversed and whether the layers are upside down.
+// Unlike the per voxel IBoard mapping, it costs one table lookup per row byte.
+struct Wiring {
+    // Shifted byte i holds the frame row rows[i].
+    uint8_t rows[8];
+    // Bit i set: shifted byte i has its bits (y) reversed.
+    uint8_t reversed;
+    // Shifted layer z holds the frame layer 7 - z.
+    bool flipLayers;
+
+    // Row bytes of the given shifted layer, in shift order.
+    void layer(const Frame& frame, uint8_t z, uint8_t out[8]) const {
+        const uint8_t* src = frame.rows[this->flipLayers ? 7 - z : z];
+        for (uint8_t i = 0; i < 8; i++) {
+            const uint8_t row = src[this->rows[i]];
+            out[i] = (this->reversed >> i) & 1 ? reverseBits(row) : row;
+        }
+    }
+};
+
+// Rows shifted as stored in the frame.
+constexpr Wiring straightWiring = {{0, 1, 2, 3, 4, 5, 6, 7}, 0, false};
@@ -0,0 +1,87 @@
+#include "Arduino.h"
+
+HardwareSerial Serial;
+
+// Per thread so the host tools can run several effects in parallel, each on its own virtual clock.
+static thread_local unsigned long long _now = 0;
+
+size_t Print::print(long n) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%ld", n);
+    return this->print(buf);
+}
+
+size_t Print::print(unsigned long n) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%lu", n);
+    return this->print(buf);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (this->_out) {
+        fputc(c, this->_out);
+    }
+    return 1;
+}
+
+unsigned long millis() {
+    return _now / 1000;
+}
+
+unsigned long micros() {
+    return _now;
+}
+
+void delay(unsigned long ms) {
+    _now += ms * 1000ULL;
+}
+
+void delayMicroseconds(unsigned int us) {
+    _now += us;
+}
+
+long random(long max) {
+    return max > 0 ? rand() % max : 0;
+}
+
+long random(long min, long max) {
+    return max > min ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) {
+    srand(seed);
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+void digitalWrite(uint8_t pin, uint8_t value) {}
+
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t value) {}
+
+static thread_local const uint16_t* _analogSamples = 0;
+static thread_local size_t _analogCount = 0;
+
+int analogRead(uint8_t pin) {
+    if (!_analogCount) {
+        return 0;
+    }
+    _analogCount--;
+    return *_analogSamples++;
+}
+
+namespace native {
+
+void setMicros(unsigned long long us) {
+    _now = us;
+}
+
+void advanceMicros(unsigned long long us) {
+    _now += us;
+}
+
+void setAnalogInput(const uint16_t* samples, size_t count) {
+    _analogSamples = samples;
+    _analogCount = count;
+}
+
+}  // namespace native
@@ -0,0 +1,108 @@
+#pragma once
+
+// Minimal subset of the Arduino API needed to run the effects and boards on the host.
+// Time is virtual: it only moves when the host tool advances it, so runs are deterministic.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define F(s) (s)
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define memcpy_P memcpy
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+// Same pins as the Uno.
+#define SS 10
+#define MOSI 11
+#define MISO 12
+#define SCK 13
+#define A0 14
+
+// Cycles are counted as on the Uno.
+#define F_CPU 16000000L
+#define clockCyclesPerMicrosecond() (F_CPU / 1000000L)
+
+class Print {
+   public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += this->write(*buffer++);
+        }
+        return n;
+    }
+    virtual int availableForWrite() { return 0; }
+
+    size_t print(const char* s) { return this->write((const uint8_t*)s, strlen(s)); }
+    size_t print(char c) { return this->write(c); }
+    size_t print(int n) { return this->print((long)n); }
+    size_t print(unsigned int n) { return this->print((unsigned long)n); }
+    size_t print(long n);
+    size_t print(unsigned long n);
+
+    size_t println() { return this->print("\r\n"); }
+    template <typename T>
+    size_t println(T value) { return this->print(value) + this->println(); }
+};
+
+// HardwareSerial writes to the given stdio stream, stdout by default, nothing when null.
+class HardwareSerial : public Print {
+   public:
+    void begin(unsigned long baud) {}
+    size_t write(uint8_t c);
+    using Print::write;
+    int availableForWrite() { return 64; }
+    // Nothing is ever received.
+    int available() { return 0; }
+    int read() { return -1; }
+
+    void setOutput(FILE* out) { this->_out = out; }
+
+   private:
+    FILE* _out = stdout;
+};
+
+extern HardwareSerial Serial;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t value);
+int analogRead(uint8_t pin);
+
+// Host only controls of the shim.
+namespace native {
+// Move the virtual clock of the calling thread, each thread starts at 0.
+void setMicros(unsigned long long us);
+void advanceMicros(unsigned long long us);
+// Samples returned by the successive analogRead calls of the calling thread, like a free running ADC, 0 once exhausted.
+// The samples are not copied.
+void setAnalogInput(const uint16_t* samples, size_t count);
+}  // namespace native
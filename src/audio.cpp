@@ -0,0 +1,127 @@
+#include "audio.h"
+
+#include "fixedmath.h"
+
+// Scales the band magnitudes, in 1/256th, so a full scale sine reads about 254.
+#define AUDIO_BAND_GAIN 13
+
+AudioInput* AudioInput::_active = 0;
+
+#ifdef __AVR__
+ISR(ADC_vect) {
+    AudioInput::active()->convert(ADCH);
+}
+#endif
+
+void AudioInput::begin() {
+    this->_head = this->_tail = 0;
+    this->_sum = this->_count = 0;
+    this->_next = ::micros();
+    _active = this;
+
+#ifdef __AVR__
+    // AVcc reference, left adjusted result so ADCH holds the 8 most significant bits.
+    const uint8_t channel = this->_pin >= A0 ? this->_pin - A0 : this->_pin;
+    ADMUX = _BV(REFS0) | _BV(ADLAR) | (channel & 0x07);
+    // Free running mode.
+    ADCSRB = 0;
+    // Enable, auto trigger, interrupt, 16MHz / 128 clock, start.
+    ADCSRA = _BV(ADEN) | _BV(ADATE) | _BV(ADIE) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0) | _BV(ADSC);
+#endif
+}
+
+void AudioInput::end() {
+    if (_active != this) {
+        return;
+    }
+#ifdef __AVR__
+    // Back to single conversions for analogRead.
+    ADCSRA &= ~(_BV(ADATE) | _BV(ADIE));
+#endif
+    _active = 0;
+}
+
+void AudioInput::poll() {
+#ifndef __AVR__
+    if (_active != this) {
+        return;
+    }
+    const unsigned long now = ::micros();
+    // Skip what would not fit in the ring anyway rather than reading a burst of samples of the same instant.
+    if (now - this->_next > (unsigned long)AUDIO_RING_SIZE * AUDIO_SAMPLE_PERIOD) {
+        this->_next = now - (unsigned long)AUDIO_RING_SIZE * AUDIO_SAMPLE_PERIOD;
+    }
+    while ((long)(now - this->_next) >= 0) {
+        this->push(::analogRead(this->_pin) >> 2);
+        this->_next += AUDIO_SAMPLE_PERIOD;
+    }
+#endif
+}
+
+void AudioInput::convert(uint8_t value) {
+    this->_sum += value;
+    if (++this->_count == 4) {
+        this->push(this->_sum >> 2);
+        this->_sum = this->_count = 0;
+    }
+}
+
+// First FFT bin of each band, the last band ends with the bins below Nyquist.
+static const uint8_t _bandBins[AUDIO_BANDS + 1] PROGMEM = {2, 3, 4, 6, 8, 11, 15, 21, AUDIO_BLOCK_SIZE / 2};
+
+bool SpectrumAnalyzer::feed(uint8_t sample) {
+    // Slowly track the bias so only the AC part of the signal is analyzed.
+    this->_bias += ((int32_t)((uint16_t)sample << 8) - this->_bias) >> 6;
+    const int16_t x = (int16_t)sample - (this->_bias >> 8);
+    this->_block[this->_count] = x > 127 ? 127 : x < -128 ? -128 : x;
+
+    if (++this->_count < AUDIO_BLOCK_SIZE) {
+        return false;
+    }
+    this->_count = 0;
+    this->analyze();
+    return true;
+}
+
+void SpectrumAnalyzer::analyze() {
+    int16_t re[AUDIO_BLOCK_SIZE];
+    int16_t im[AUDIO_BLOCK_SIZE];
+
+    // Hann window, (1 - cos) / 2 in [0, 255], in bit reversed order for the in place FFT.
+    for (uint8_t i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+        uint8_t r = 0;
+        for (uint8_t b = 1, v = i; b < AUDIO_BLOCK_SIZE; b <<= 1, v >>= 1) {
+            r = (r << 1) | (v & 1);
+        }
+        re[r] = (this->_block[i] * (255 - icos(i * (256 / AUDIO_BLOCK_SIZE)))) >> 2;
+        im[r] = 0;
+    }
+
+    // Radix 2 butterflies, halved at each stage so the values stay within 16 bits.
+    for (uint8_t half = 1; half < AUDIO_BLOCK_SIZE; half <<= 1) {
+        for (uint8_t k = 0; k < half; k++) {
+            const uint8_t angle = k * (128 / half);
+            const int32_t wr = icos(angle);
+            const int32_t wi = -isin(angle);
+            for (uint8_t i = k; i < AUDIO_BLOCK_SIZE; i += 2 * half) {
+                const uint8_t j = i + half;
+                const int16_t tr = (re[j] * wr - im[j] * wi) >> 8;
+                const int16_t ti = (re[j] * wi + im[j] * wr) >> 8;
+                re[j] = (re[i] - tr) >> 1;
+                im[j] = (im[i] - ti) >> 1;
+                re[i] = (re[i] + tr) >> 1;
+                im[i] = (im[i] + ti) >> 1;
+            }
+        }
+    }
+
+    // Band magnitude from the power of its bins.
+    for (uint8_t b = 0; b < AUDIO_BANDS; b++) {
+        uint32_t power = 0;
+        const uint8_t end = pgm_read_byte(&_bandBins[b + 1]);
+        for (uint8_t k = pgm_read_byte(&_bandBins[b]); k < end; k++) {
+            power += (uint32_t)((int32_t)re[k] * re[k] + (int32_t)im[k] * im[k]);
+        }
+        this->_bands[b] = isqrt(power) * AUDIO_BAND_GAIN >> 8;
+    }
+}
@@ -0,0 +1,246 @@
+#ifdef BENCHMARK
+
+#include <Arduino.h>
+
+#include "audio.h"
+#include "baked.h"
+#include "cube.h"
+#include "effects.h"
+#include "exprbench.h"
+#include "frametap.h"
+#include "life.h"
+#include "particles.h"
+#include "programs/planeboing.h"
+#include "programs/rain.h"
+#include "rng.h"
+#include "vm.h"
+
+// Number of calls per benchmark.
+#define BENCH_ITERATIONS 2000
+
+// Results are accumulated here so the compiler can't optimize the benchmarked code away.
+volatile uint32_t benchSink;
+
+// bench runs the given function BENCH_ITERATIONS times and prints the average cost of a call in CPU cycles.
+template <typename F>
+void bench(const char* name, F f) {
+    unsigned long start = ::micros();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        f();
+    }
+    unsigned long elapsed = ::micros() - start;
+
+    Serial.print(name);
+    Serial.print(": ");
+    Serial.print(elapsed * clockCyclesPerMicrosecond() / BENCH_ITERATIONS);
+    Serial.println(" cycles");
+}
+
+void benchRng() {
+    Rng rng(42);
+    ::randomSeed(42);
+
+    bench("empty loop", []() { benchSink = benchSink + 1; });
+
+    // Single coordinate within the cube.
+    bench("random(0, 8)", []() { benchSink = benchSink + ::random(0, 8); });
+    bench("Rng::below(8)", [&rng]() { benchSink = benchSink + rng.below(8); });
+    bench("Rng::bits(3)", [&rng]() { benchSink = benchSink + rng.bits(3); });
+
+    // Voxel index, as used by Glowing.
+    bench("random(0, 512)", []() { benchSink = benchSink + ::random(0, 512); });
+    bench("Rng::below(512)", [&rng]() { benchSink = benchSink + rng.below(512); });
+
+    // Worst case of Rain::step: 1 + 2 x maxDroplets draws.
+    bench("Rain draws with random()", []() {
+        int drops = ::random(0, 5);
+        for (int i = 0; i < 5; i++) {
+            benchSink = benchSink + ::random(0, 8) + ::random(0, 8) + drops;
+        }
+    });
+    bench("Rain draws with Rng", [&rng]() {
+        int drops = rng.below(5);
+        for (int i = 0; i < 5; i++) {
+            benchSink = benchSink + rng.bits(3) + rng.bits(3) + drops;
+        }
+    });
+
+    // One bit per voxel of a layer, as used by SendVoxels::init.
+    bench("64 x random(0, 2)", []() {
+        for (int i = 0; i < 64; i++) {
+            benchSink = benchSink + ::random(0, 2);
+        }
+    });
+    bench("Rng::bits64()", [&rng]() { benchSink = benchSink + (uint32_t)rng.bits64(); });
+}
+
+void benchParticles() {
+    static ParticlePool<100> pool(ParticlePool<100>::walls::bounce);
+    static Frame frame;
+    Rng rng(42);
+
+    // A full pool of sparks flying around, never expiring.
+    pool.setGravity(0, 0, -6);
+    Emitter burst = {{4 * FIXED_ONE, 4 * FIXED_ONE, 4 * FIXED_ONE}, {0, 0, 0}, {0, 0, 0}, 96, 0};
+    burst.emit(pool, rng, 100);
+
+    bench("100 particles update", []() { pool.update(); });
+    bench("100 particles render", []() {
+        frame.clear();
+        pool.render(frame);
+    });
+}
+
+void benchWaves() {
+    static Cube cube;
+    static SineWave sineWave;
+    static Ripple ripple;
+    static Plasma plasma;
+
+    bench("SineWave::step", []() { sineWave.step(cube); });
+    bench("Ripple::step", []() { ripple.step(cube); });
+    bench("Plasma::step", []() { plasma.step(cube); });
+}
+
+void benchAudio() {
+    static SpectrumAnalyzer analyzer;
+    static uint8_t phase = 0;
+
+    // Cost per sample, to be multiplied by AUDIO_SAMPLE_RATE for the share of CPU time.
+    bench("SpectrumAnalyzer::feed", []() {
+        phase += 23;
+        benchSink = benchSink + analyzer.feed(128 + (isin(phase) >> 2));
+    });
+}
+
+void benchLife() {
+    static Frame frame;
+    static Rng rng(42);
+
+    // Fresh soup on each call so the generation is never trivially empty.
+    bench("lifeStep 4555 wrap", []() {
+        for (int z = 0; z < 8; z++) {
+            const uint64_t layer = rng.bits64() & rng.bits64();
+            memcpy(frame.rows[z], &layer, 8);
+        }
+        lifeStep(frame, frame, LifeRule::bays(4, 5, 5, 5), true);
+        benchSink = benchSink + frame.rows[3][3];
+    });
+    bench("soup only", []() {
+        for (int z = 0; z < 8; z++) {
+            const uint64_t layer = rng.bits64() & rng.bits64();
+            memcpy(frame.rows[z], &layer, 8);
+        }
+        benchSink = benchSink + frame.rows[3][3];
+    });
+}
+
+void benchVm() {
+    static Cube cube;
+    static Rain rain(100, 5);
+    static Bytecode vmRain(rainProgram);
+    static PlaneBoing planeBoing(100);
+    static Bytecode vmPlaneBoing(planeboingProgram);
+
+    planeBoing.init(cube);
+    vmPlaneBoing.init(cube);
+
+    bench("Rain::step", []() { rain.step(cube); });
+    bench("Rain bytecode step", []() { vmRain.step(cube); });
+    bench("PlaneBoing::step", []() { planeBoing.step(cube); });
+    bench("PlaneBoing bytecode step", []() { vmPlaneBoing.step(cube); });
+}
+
+void benchExpr() {
+    static Cube cube;
+    static Cube other;
+    static const ExprBenchPair* pair;
+
+    for (int i = 0; i < 8; i++) {
+        other.fill(Plane::Z(i), i & 1);
+        other.setVoxel(i, 7 - i, i, 1);
+    }
+    for (const ExprBenchPair& p : exprBenchPairs) {
+        pair = &p;
+        Serial.println(p.name);
+        bench("  eager", []() { pair->eager(cube, other); benchSink = benchSink + cube.getRow(3, 3); });
+        bench("  fused", []() { pair->fused(cube, other); benchSink = benchSink + cube.getRow(3, 3); });
+    }
+}
+
+// Takes everything, so the frame tap costs don't include the UART.
+class NullPrint : public Print {
+   public:
+    size_t write(uint8_t) { return 1; }
+    int availableForWrite() { return FRAME_TAP_CHUNK; }
+};
+
+void benchFrameTap() {
+    static Cube cube;
+    static FrameTap tap;
+    static NullPrint out;
+
+    // The record is never sent, each capture replaces it.
+    bench("FrameTap::capture", []() { tap.capture(cube, 3, benchSink); });
+    bench("FrameTap::capture + send", []() {
+        tap.capture(cube, 3, benchSink);
+        while (tap.drain(out)) {
+        }
+    });
+}
+
+// Step of an effect computed live and replayed from its baked table, see `ledcube bake`.
+#define BENCH_BAKED(type, baked, ...)                            \
+    {                                                            \
+        static type live(__VA_ARGS__);                           \
+        static CachedEffect cached(baked, 1);                    \
+        bench(#type "::step", []() { live.step(cube); });        \
+        bench(#type " baked step", []() { cached.step(cube); }); \
+    }
+
+void benchBaked() {
+    static Cube cube;
+
+#ifdef BAKED_VOXEL_EXPLORER
+    BENCH_BAKED(VoxelExplorer, bakedVoxelExplorer, 100);
+#endif
+#ifdef BAKED_PLANE_BOING
+    BENCH_BAKED(PlaneBoing, bakedPlaneBoing, 100);
+#endif
+#ifdef BAKED_FULLY_ON
+    BENCH_BAKED(FullyOn, bakedFullyOn);
+#endif
+#ifdef BAKED_WOOP_WOOP
+    BENCH_BAKED(WoopWoop, bakedWoopWoop, 100);
+#endif
+#ifdef BAKED_SINE_WAVE
+    BENCH_BAKED(SineWave, bakedSineWave, 20);
+#endif
+#ifdef BAKED_RIPPLE
+    BENCH_BAKED(Ripple, bakedRipple, 20);
+#endif
+#ifdef BAKED_PLASMA
+    BENCH_BAKED(Plasma, bakedPlasma, 20);
+#endif
+}
+
+void setup() {
+    Serial.begin(9600);
+    Serial.println("");
+    Serial.println("Benchmarking!");
+
+    benchRng();
+    benchParticles();
+    benchWaves();
+    benchAudio();
+    benchLife();
+    benchVm();
+    benchExpr();
+    benchFrameTap();
+    benchBaked();
+}
+
+void loop() {
+}
+
+#endif
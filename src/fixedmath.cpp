@@ -0,0 +1,73 @@
+#include "fixedmath.h"
+
+#include <Arduino.h>
+
+// First quarter of the sine wave, 255 * sin(i * 90 / 64 degrees).
+static const uint8_t _quarterSine[65] PROGMEM = {
+    0, 6, 13, 19, 25, 31, 37, 44, 50, 56, 62, 68, 74,
+    80, 86, 92, 98, 103, 109, 115, 120, 126, 131, 136, 142, 147,
+    152, 157, 162, 167, 171, 176, 180, 185, 189, 193, 197, 201, 205,
+    208, 212, 215, 219, 222, 225, 228, 231, 233, 236, 238, 240, 242,
+    244, 246, 247, 249, 250, 251, 252, 253, 254, 254, 255, 255, 255,
+};
+
+int16_t isin(uint8_t angle) {
+    uint8_t i = angle & 63;
+    // The second and fourth quarters go backward in the table.
+    if (angle & 64) {
+        i = 64 - i;
+    }
+    int16_t value = pgm_read_byte(&_quarterSine[i]);
+    // The second half is negative.
+    return angle & 128 ? -value : value;
+}
+
+uint16_t isqrt(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = (uint32_t)1 << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+uint16_t approxDist(int16_t dx, int16_t dy) {
+    uint16_t a = dx < 0 ? -dx : dx;
+    uint16_t b = dy < 0 ? -dy : dy;
+    if (a < b) {
+        uint16_t t = a;
+        a = b;
+        b = t;
+    }
+    // Alpha max plus beta min, alpha = 15/16, beta = 15/32.
+    return a - (a >> 4) + (b >> 1) - (b >> 5);
+}
+
+uint16_t approxDist(int16_t dx, int16_t dy, int16_t dz) {
+    uint16_t a = dx < 0 ? -dx : dx;
+    uint16_t b = dy < 0 ? -dy : dy;
+    uint16_t c = dz < 0 ? -dz : dz;
+    uint16_t t;
+    // Sort so a >= b >= c.
+    if (a < b) {
+        t = a, a = b, b = t;
+    }
+    if (b < c) {
+        t = b, b = c, c = t;
+    }
+    if (a < b) {
+        t = a, a = b, b = t;
+    }
+    // max + 11/32 mid + 1/4 min, the product overflows 16 bits past 5957.
+    return a + (((uint32_t)b * 11) >> 5) + (c >> 2);
+}
@@ -0,0 +1,51 @@
+#include "frametap.h"
+
+void FrameTap::capture(const ICubeRO& cube, uint8_t effect, unsigned long now) {
+    const uint16_t frame = this->_frame++;
+    if (this->busy()) {
+        this->_skipped++;
+        return;
+    }
+    if (this->_sent == 0) {
+        // Never started, the newer frame is worth more.
+        this->_skipped++;
+    }
+
+    uint8_t* r = this->_record;
+    r[0] = 0xfc;
+    r[1] = 0xcb;
+    r[2] = frame;
+    r[3] = frame >> 8;
+    const uint32_t time = now;
+    r[4] = time;
+    r[5] = time >> 8;
+    r[6] = time >> 16;
+    r[7] = time >> 24;
+    r[8] = effect;
+    Frame f;
+    cube.read(f);
+    memcpy(r + 9, f.rows, sizeof(f.rows));
+
+    uint8_t sum = 0;
+    for (uint8_t i = 2; i < FRAME_TAP_RECORD_SIZE - 1; i++) {
+        sum += r[i];
+    }
+    r[FRAME_TAP_RECORD_SIZE - 1] = sum;
+    this->_sent = 0;
+}
+
+bool FrameTap::drain(Print& out) {
+    if (this->_sent >= FRAME_TAP_RECORD_SIZE) {
+        return false;
+    }
+    const int room = out.availableForWrite();
+    if (room <= 0) {
+        return true;
+    }
+    uint8_t n = FRAME_TAP_RECORD_SIZE - this->_sent;
+    n = n > FRAME_TAP_CHUNK ? FRAME_TAP_CHUNK : n;
+    n = n > room ? room : n;
+    out.write(this->_record + this->_sent, n);
+    this->_sent += n;
+    return true;
+}
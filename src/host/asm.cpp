@@ -0,0 +1,242 @@
+#ifdef NATIVE
+
+#include "asm.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+
+#include "vm.h"
+
+struct Mnemonic {
+    const char* name;
+    uint8_t op;
+};
+
+static const Mnemonic mnemonics[] = {
+#define VM_MNEMONIC(name, mnemonic, operands) {mnemonic, vm_##name},
+    VM_OPS(VM_MNEMONIC)
+#undef VM_MNEMONIC
+};
+
+struct Statement {
+    int line;
+    std::vector<std::string> tokens;
+};
+
+struct Assembler {
+    const char* name;
+    std::map<std::string, long> equs;
+    std::map<std::string, long> labels;
+    bool ok = true;
+
+    void error(int line, const char* msg, const std::string& token = "") {
+        fprintf(stderr, "%s:%d: %s%s%s\n", this->name, line, msg, token.empty() ? "" : ": ", token.c_str());
+        this->ok = false;
+    }
+
+    // Number or named constant.
+    bool value(int line, const std::string& token, long& v) {
+        auto equ = this->equs.find(token);
+        if (equ != this->equs.end()) {
+            v = equ->second;
+            return true;
+        }
+        char* end;
+        v = strtol(token.c_str(), &end, 0);
+        if (token.compare(0, 2, "0b") == 0) {
+            v = strtol(token.c_str() + 2, &end, 2);
+        }
+        if (token.empty() || *end) {
+            this->error(line, "invalid value", token);
+            return false;
+        }
+        return true;
+    }
+
+    bool address(int line, const std::string& token, long& v) {
+        auto label = this->labels.find(token);
+        if (label == this->labels.end()) {
+            this->error(line, "unknown label", token);
+            return false;
+        }
+        v = label->second;
+        return true;
+    }
+
+    const Mnemonic* lookup(const std::string& token) {
+        for (const Mnemonic& m : mnemonics) {
+            if (token == m.name) {
+                return &m;
+            }
+        }
+        return 0;
+    }
+
+    // Opcode and size of the given instruction statement, 0 if invalid.
+    int size(const Statement& s, uint8_t& op) {
+        const std::string& mnemonic = s.tokens[0];
+        if (mnemonic == "push") {
+            long v;
+            if (s.tokens.size() != 2 || !this->value(s.line, s.tokens[1], v)) {
+                this->error(s.line, "push takes a value");
+                return 0;
+            }
+            op = v >= -128 && v <= 127 ? vm_push8 : vm_push16;
+            return op == vm_push8 ? 2 : 3;
+        }
+        const Mnemonic* m = this->lookup(mnemonic);
+        if (!m) {
+            this->error(s.line, "unknown instruction", mnemonic);
+            return 0;
+        }
+        op = m->op;
+        const uint8_t kind = vmOperands(op);
+        const size_t operands = kind == VM_NONE ? 0 : kind == VM_VAR_ADDR ? 2 : 1;
+        if (s.tokens.size() != operands + 1) {
+            this->error(s.line, "wrong number of operands", mnemonic);
+            return 0;
+        }
+        return 1 + vmOperandSize(kind);
+    }
+
+    void emit(const Statement& s, uint8_t op, std::vector<uint8_t>& code) {
+        code.push_back(op);
+        long v = 0, addr = 0;
+        switch (vmOperands(op)) {
+            case VM_I8:
+            case VM_VAR:
+                if (this->value(s.line, s.tokens[1], v)) {
+                    if (vmOperands(op) == VM_VAR && (v < 0 || v >= VM_VARIABLES)) {
+                        this->error(s.line, "invalid variable", s.tokens[1]);
+                    }
+                }
+                code.push_back(v);
+                break;
+            case VM_I16:
+                if (this->value(s.line, s.tokens[1], v) && (v < -32768 || v > 65535)) {
+                    this->error(s.line, "value out of range", s.tokens[1]);
+                }
+                code.push_back(v & 0xff);
+                code.push_back((v >> 8) & 0xff);
+                break;
+            case VM_ADDR:
+                this->address(s.line, s.tokens[1], addr);
+                code.push_back(addr & 0xff);
+                code.push_back(addr >> 8);
+                break;
+            case VM_VAR_ADDR:
+                if (this->value(s.line, s.tokens[1], v) && (v < 0 || v >= VM_VARIABLES)) {
+                    this->error(s.line, "invalid variable", s.tokens[1]);
+                }
+                this->address(s.line, s.tokens[2], addr);
+                code.push_back(v);
+                code.push_back(addr & 0xff);
+                code.push_back(addr >> 8);
+                break;
+        }
+    }
+};
+
+static std::vector<std::string> tokenize(const char* line) {
+    std::vector<std::string> tokens;
+    std::string token;
+    for (const char* p = line;; p++) {
+        if (!*p || *p == ';' || isspace(*p) || *p == ',') {
+            if (!token.empty()) {
+                tokens.push_back(token);
+                token.clear();
+            }
+            if (!*p || *p == ';') {
+                return tokens;
+            }
+            continue;
+        }
+        token += *p;
+    }
+}
+
+bool assemble(FILE* in, const char* name, std::vector<uint8_t>& image) {
+    Assembler as;
+    as.name = name;
+    long interval = 100;
+
+    // First pass: directives and label addresses.
+    std::vector<Statement> statements;
+    std::vector<uint8_t> ops;
+    long pc = 0;
+    char buf[512];
+    for (int line = 1; fgets(buf, sizeof(buf), in); line++) {
+        Statement s = {line, tokenize(buf)};
+        while (!s.tokens.empty() && s.tokens[0].back() == ':') {
+            const std::string label = s.tokens[0].substr(0, s.tokens[0].size() - 1);
+            if (as.labels.count(label)) {
+                as.error(line, "duplicate label", label);
+            }
+            as.labels[label] = pc;
+            s.tokens.erase(s.tokens.begin());
+        }
+        if (s.tokens.empty()) {
+            continue;
+        }
+        if (s.tokens[0] == ".interval" && s.tokens.size() == 2) {
+            as.value(line, s.tokens[1], interval);
+            continue;
+        }
+        if (s.tokens[0] == ".equ" && s.tokens.size() == 3) {
+            long v;
+            if (as.value(line, s.tokens[2], v)) {
+                as.equs[s.tokens[1]] = v;
+            }
+            continue;
+        }
+        if (s.tokens[0][0] == '.') {
+            as.error(line, "invalid directive", s.tokens[0]);
+            continue;
+        }
+        uint8_t op = 0;
+        pc += as.size(s, op);
+        statements.push_back(s);
+        ops.push_back(op);
+    }
+
+    if (!as.labels.count("step")) {
+        as.error(0, "missing step label");
+    }
+    if (pc > VM_PROGRAM_SIZE) {
+        fprintf(stderr, "%s: program too large: %ld bytes, the limit is %d\n", name, pc, VM_PROGRAM_SIZE);
+        as.ok = false;
+    }
+    if (!as.ok) {
+        return false;
+    }
+
+    // Second pass: code.
+    std::vector<uint8_t> code;
+    for (size_t i = 0; i < statements.size(); i++) {
+        as.emit(statements[i], ops[i], code);
+    }
+    if (!as.ok) {
+        return false;
+    }
+
+    const long init = as.labels.count("init") ? as.labels["init"] : code.size();
+    const long header[] = {interval, init, as.labels["step"], (long)code.size()};
+    image = {'L', 'V', VM_VERSION};
+    for (long v : header) {
+        image.push_back(v & 0xff);
+        image.push_back((v >> 8) & 0xff);
+    }
+    image.insert(image.end(), code.begin(), code.end());
+    uint8_t sum = 0;
+    for (uint8_t b : image) {
+        sum += b;
+    }
+    image.push_back(sum);
+    return true;
+}
+
+#endif
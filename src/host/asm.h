@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <vector>
+
+// Assembler for the bytecode effects, see vm.h for the instruction set and the program image.
+//
+// Syntax, one statement per line, ';' starts a comment:
+//   label:                  Jump target. `init:` and `step:` are the entry points, init is optional.
+//   .interval <ms>          Step interval, 100ms by default.
+//   .equ <name> <value>     Named constant, usable wherever a number is, e.g. for variables.
+//   <mnemonic> [operands]   Instruction, operands separated by spaces or commas.
+//                           `push <value>` picks push8 or push16 based on the value.
+
+// Assemble the given source into a program image. Errors are reported on stderr as <name>:<line>.
+bool assemble(FILE* in, const char* name, std::vector<uint8_t>& image);
@@ -0,0 +1,1212 @@
+#if defined(NATIVE) && !defined(PIO_UNIT_TESTING)
+
+// Host tool running the effects against the Arduino shim, in virtual time.
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "asm.h"
+#include "audio.h"
+#include "cachedeffect.h"
+#include "cube.h"
+#include "effects.h"
+#include "exprbench.h"
+#include "fanoutboard.h"
+#include "governor.h"
+#include "life.h"
+#include "log.h"
+#include "metrics.h"
+#include "playlist.h"
+#include "preview.h"
+#include "programs/planeboing.h"
+#include "programs/rain.h"
+#include "shiftpulseboard.h"
+#include "tap.h"
+#include "trace.h"
+#include "vm.h"
+#include "wav.h"
+#include "webserver.h"
+
+static int usage() {
+    fprintf(stderr,
+            "usage: ledcube <command> [args]\n"
+            "\n"
+            "  list                                       List the registered effects.\n"
+            "  record <effect> <seconds> <file> [seed]    Run an effect in virtual time and record its frames.\n"
+            "  record-all <dir> <seconds> [seed]          Record a trace per effect in <dir>/effect-<n>.trace.\n"
+            "  compare <trace> <trace>                    Compare two traces, fails on the first difference.\n"
+            "  replay <trace>                             Print the frames of a trace.\n"
+            "  bench <trace> [iterations]                 Replay a trace through the shift board and report throughput.\n"
+            "  audio <wav|tone:hz[:ms]>                   Feed audio through the ADC shim, print the band magnitudes per block.\n"
+            "  life [generations] [seed]                  Check the 3D life kernel against a naive implementation and time both.\n"
+            "  asm <source> <out> [symbol]                Assemble a bytecode effect, as a C header if <out> ends with .h.\n"
+            "  vm <program> <seconds> <file> [seed]       Load a bytecode program image and record it.\n"
+            "  vm-bench [steps]                           Compare the native and bytecode Rain and PlaneBoing step costs.\n"
+            "  expr-bench [iterations]                    Check the fused cube expressions against eager drawing and time both.\n"
+            "  fanout-bench [outputs] [iterations]        Compare rendering to several mapped boards with a fan out board.\n"
+            "  bake <out.h> [frames] [steps]              Precompute the effects without randomness repeating within [frames]\n"
+            "                                             into flash tables, e.g. include/baked.h, and report their cost.\n"
+            "  tap-sim <seconds> <trace> [baud] [seed]    Run the playlist with and without the frame tap on a simulated Serial,\n"
+            "                                             check the refresh rate is the same and record the tapped frames.\n"
+            "  tap <input> <trace> [--live]               Decode a frame tap stream, e.g. a Serial device, into a trace.\n"
+            "  metrics <seconds> [port] [seed]            Run the playlist as the ESP8266 firmware does and print its /metrics page,\n"
+            "                                             or serve it on http://localhost:<port>/metrics in real time.\n"
+            "  preview <dir> <seconds> [options]          Render isometric previews in <dir>/effect-<n>.gif, in parallel.\n"
+            "      -e <effects>                           Effects to render, ex: 0,3,5-7, all by default.\n"
+            "      -j <threads>                           Number of threads, one per core by default.\n"
+            "      -r <ms>                                Sampling interval, 40 by default, at least 20.\n"
+            "      -s <seed>                              Seed of the effects, 1 by default.\n"
+            "      --png                                  Write <dir>/effect-<n>-<sample>.png sequences instead.\n");
+    return 2;
+}
+
+// TerminalBoard prints each frame as the 8 z layers side by side.
+class TerminalBoard : public IBoard {
+   public:
+    void setup() const {}
+
+    void render(const ICubeRO& cube) const {
+        printf("t=%lums\n", ::millis());
+        for (int y = 7; y >= 0; y--) {
+            for (int z = 0; z < 8; z++) {
+                for (int x = 0; x < 8; x++) {
+                    putchar(this->getVoxel(cube, x, y, z) ? '#' : '.');
+                }
+                putchar(z == 7 ? '\n' : ' ');
+            }
+        }
+        putchar('\n');
+    }
+};
+
+static int record(int idx, unsigned long seconds, const char* path, unsigned long seed) {
+    if (idx < 0 || idx >= registry.size()) {
+        fprintf(stderr, "unknown effect #%d\n", idx);
+        return 1;
+    }
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return 1;
+    }
+    TraceRecorder recorder(out);
+    registry.rng().seed(seed);
+    runEffect(registry.activate(idx), seconds, recorder);
+    fclose(out);
+    printf("effect #%d: %lu records in %s\n", idx, recorder.records(), path);
+    return 0;
+}
+
+static int compare(const char* pathA, const char* pathB) {
+    FILE* a = fopen(pathA, "rb");
+    FILE* b = fopen(pathB, "rb");
+    if (!a || !b) {
+        perror(a ? pathB : pathA);
+        return 1;
+    }
+    TraceReader traceA(a);
+    TraceReader traceB(b);
+    if (!traceA.valid() || !traceB.valid()) {
+        fprintf(stderr, "invalid trace\n");
+        return 1;
+    }
+
+    Frame frameA, frameB;
+    unsigned long timeA, timeB;
+    for (unsigned long n = 0;; n++) {
+        bool okA = traceA.next(frameA, timeA);
+        bool okB = traceB.next(frameB, timeB);
+        if (!okA && !okB) {
+            printf("identical, %lu records\n", n);
+            return 0;
+        }
+        if (okA != okB) {
+            printf("record #%lu: %s ends first\n", n, okA ? pathB : pathA);
+            return 1;
+        }
+        if (timeA != timeB || frameA != frameB) {
+            printf("record #%lu differs: t=%lums vs t=%lums\n", n, timeA, timeB);
+            return 1;
+        }
+    }
+}
+
+static int replayTrace(const char* path) {
+    FILE* in = fopen(path, "rb");
+    if (!in) {
+        perror(path);
+        return 1;
+    }
+    TraceReader trace(in);
+    if (!trace.valid()) {
+        fprintf(stderr, "%s: invalid trace\n", path);
+        return 1;
+    }
+    Cube cube;
+    TerminalBoard board;
+    replay(trace, board, cube);
+    fclose(in);
+    return 0;
+}
+
+static int bench(const char* path, int iterations) {
+    Cube cube;
+    ShiftPulseBoard board(SCK, SS, MOSI);
+    unsigned long frames = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        FILE* in = fopen(path, "rb");
+        if (!in) {
+            perror(path);
+            return 1;
+        }
+        TraceReader trace(in);
+        frames += replay(trace, board, cube);
+        fclose(in);
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%lu frames in %.3fs: %.0f frames/s, %.0fns/frame\n", frames, elapsed, frames / elapsed, elapsed * 1e9 / frames);
+    return 0;
+}
+
+// Run the audio input and spectrum analyzer over the given source, in virtual time.
+// Each block is timed on its own, as the loop would feed it.
+static int audio(const char* source) {
+    std::vector<uint16_t> samples;
+    if (!loadAudio(source, samples)) {
+        return 1;
+    }
+    native::setMicros(0);
+    native::setAnalogInput(samples.data(), samples.size());
+
+    AudioInput input;
+    SpectrumAnalyzer analyzer;
+    input.begin();
+
+    uint8_t block[AUDIO_BLOCK_SIZE];
+    int fill = 0;
+    unsigned long blocks = 0;
+    double sums[AUDIO_BANDS] = {};
+    double totalNs = 0, maxNs = 0;
+
+    // Bands by their lowest bin, see SpectrumAnalyzer.
+    printf("    t(ms)   75Hz  113Hz  150Hz  225Hz  300Hz  413Hz  564Hz  789Hz  block(ns)\n");
+    const unsigned long long duration = (unsigned long long)samples.size() * AUDIO_SAMPLE_PERIOD;
+    for (unsigned long long t = 0; t < duration; t += tickMicros) {
+        native::setMicros(t);
+        input.poll();
+        while (input.read(block[fill])) {
+            if (++fill < AUDIO_BLOCK_SIZE) {
+                continue;
+            }
+            fill = 0;
+
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+                analyzer.feed(block[i]);
+            }
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            totalNs += ns;
+            maxNs = ns > maxNs ? ns : maxNs;
+
+            printf("%9lu", ::millis());
+            for (int b = 0; b < AUDIO_BANDS; b++) {
+                printf(" %6u", analyzer.band(b));
+                sums[b] += analyzer.band(b);
+            }
+            printf(" %10.0f\n", ns);
+            blocks++;
+        }
+    }
+    if (!blocks) {
+        fprintf(stderr, "%s: not enough samples for a block\n", source);
+        return 1;
+    }
+
+    printf("     mean");
+    for (int b = 0; b < AUDIO_BANDS; b++) {
+        printf(" %6.0f", sums[b] / blocks);
+    }
+    printf("\n%lu blocks, %.0fns/block mean, %.0fns max, %u overruns\n", blocks, totalNs / blocks, maxNs, input.overruns());
+    return 0;
+}
+
+// Straightforward 3D life generation, counting the 26 neighbours of each voxel through the cube interface.
+static void naiveLifeStep(const Cube& in, Cube& out, const LifeRule& rule, bool wrap) {
+    for (int z = 0; z < 8; z++) {
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 8; x++) {
+                int n = 0;
+                for (int dz = -1; dz <= 1; dz++) {
+                    for (int dy = -1; dy <= 1; dy++) {
+                        for (int dx = -1; dx <= 1; dx++) {
+                            int nx = x + dx, ny = y + dy, nz = z + dz;
+                            if (!(dx || dy || dz)) {
+                                continue;
+                            }
+                            if (wrap) {
+                                nx &= 7, ny &= 7, nz &= 7;
+                            } else if (nx < 0 || nx > 7 || ny < 0 || ny > 7 || nz < 0 || nz > 7) {
+                                continue;
+                            }
+                            n += in.getVoxel(nx, ny, nz);
+                        }
+                    }
+                }
+                const uint32_t set = in.getVoxel(x, y, z) ? rule.survive : rule.birth;
+                out.setVoxel(x, y, z, (set >> n) & 1);
+            }
+        }
+    }
+}
+
+static int life(int generations, unsigned long seed) {
+    static const struct {
+        const char* name;
+        LifeRule rule;
+    } rules[] = {
+        {"4555", LifeRule::bays(4, 5, 5, 5)},
+        {"5766", LifeRule::bays(5, 7, 6, 6)},
+        {"2645", LifeRule::bays(2, 6, 4, 5)},
+    };
+
+    Rng rng(seed);
+    for (const auto& r : rules) {
+        for (int wrap = 0; wrap < 2; wrap++) {
+            Frame fast, naive;
+            for (int z = 0; z < 8; z++) {
+                const uint64_t layer = rng.bits64() & rng.bits64();
+                memcpy(fast.rows[z], &layer, 8);
+            }
+            naive = fast;
+
+            Cube in, out;
+            double fastNs = 0, naiveNs = 0;
+            for (int g = 0; g < generations; g++) {
+                auto start = std::chrono::steady_clock::now();
+                lifeStep(fast, fast, r.rule, wrap);
+                auto mid = std::chrono::steady_clock::now();
+                in.write(naive);
+                naiveLifeStep(in, out, r.rule, wrap);
+                out.read(naive);
+                auto end = std::chrono::steady_clock::now();
+                fastNs += std::chrono::duration<double, std::nano>(mid - start).count();
+                naiveNs += std::chrono::duration<double, std::nano>(end - mid).count();
+
+                if (fast != naive) {
+                    printf("%s %s: generation %d differs\n", r.name, wrap ? "wrap" : "bounded", g);
+                    return 1;
+                }
+            }
+            printf("%s %-7s: %d generations identical, %.0fns/generation vs %.0fns naive\n",
+                   r.name, wrap ? "wrap" : "bounded", generations, fastNs / generations, naiveNs / generations);
+        }
+    }
+    return 0;
+}
+
+static int assembleFile(const char* source, const char* path, const char* symbol) {
+    FILE* in = fopen(source, "r");
+    if (!in) {
+        perror(source);
+        return 1;
+    }
+    std::vector<uint8_t> image;
+    bool ok = assemble(in, source, image);
+    fclose(in);
+    if (!ok) {
+        return 1;
+    }
+
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return 1;
+    }
+    const size_t len = strlen(path);
+    if (len > 2 && !strcmp(path + len - 2, ".h")) {
+        fprintf(out, "#pragma once\n\n// Generated by `ledcube asm %s %s %s`, do not edit.\n\n#include <Arduino.h>\n\n", source, path, symbol ? symbol : "program");
+        fprintf(out, "static const uint8_t %s[] PROGMEM = {", symbol ? symbol : "program");
+        for (size_t i = 0; i < image.size(); i++) {
+            fprintf(out, "%s0x%02x,", i % 12 ? " " : "\n    ", image[i]);
+        }
+        fprintf(out, "\n};\n");
+    } else {
+        fwrite(image.data(), 1, image.size(), out);
+    }
+    fclose(out);
+    printf("%s: %zu bytes of code\n", path, image.size() - VM_HEADER_SIZE - 1);
+    return 0;
+}
+
+static Bytecode vm;
+
+static Bytecode* vmTarget() {
+    return &vm;
+}
+
+// Load the program image through the same loader as the board and record its frames.
+static int recordProgram(const char* image, unsigned long seconds, const char* path, unsigned long seed) {
+    FILE* in = fopen(image, "rb");
+    if (!in) {
+        perror(image);
+        return 1;
+    }
+    ProgramLoader loader(vmTarget);
+    ProgramLoader::status status = ProgramLoader::idle;
+    for (int c; (c = fgetc(in)) != EOF && status != ProgramLoader::failed;) {
+        status = loader.feed(c, 0);
+    }
+    fclose(in);
+    if (status != ProgramLoader::done) {
+        fprintf(stderr, "%s: invalid program\n", image);
+        return 1;
+    }
+
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return 1;
+    }
+    TraceRecorder recorder(out);
+    registry.rng().seed(seed);
+    vm.attach(registry.rng());
+    runEffect(&vm, seconds, recorder);
+    fclose(out);
+    printf("%s: %lu records in %s\n", image, recorder.records(), path);
+    return 0;
+}
+
+// Average cost of a step of the given effect, in ns.
+static double timeSteps(IEffect& effect, int steps) {
+    Cube cube;
+    effect.init(cube);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < steps; i++) {
+        effect.step(cube);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / steps;
+}
+
+static int vmBench(int steps) {
+    Rain rain(100, 5);
+    Bytecode vmRain(rainProgram);
+    PlaneBoing planeBoing(100);
+    Bytecode vmPlaneBoing(planeboingProgram);
+
+    const struct {
+        const char* name;
+        IEffect& native;
+        IEffect& bytecode;
+    } pairs[] = {
+        {"Rain", rain, vmRain},
+        {"PlaneBoing", planeBoing, vmPlaneBoing},
+    };
+    for (const auto& p : pairs) {
+        const double native = timeSteps(p.native, steps);
+        const double bytecode = timeSteps(p.bytecode, steps);
+        printf("%-10s: %.0fns/step native, %.0fns/step bytecode, %.2fx\n", p.name, native, bytecode, bytecode / native);
+    }
+    return 0;
+}
+
+static void randomCube(Rng& rng, Cube& cube) {
+    Frame frame;
+    for (int z = 0; z < 8; z++) {
+        const uint64_t layer = rng.bits64();
+        memcpy(frame.rows[z], &layer, 8);
+    }
+    cube.write(frame);
+}
+
+static double timeDrawing(void (*draw)(ICube&, const Cube&), ICube& cube, const Cube& other, int iterations) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        draw(cube, other);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+static int exprBench(int iterations) {
+    Rng rng(42);
+    for (const ExprBenchPair& p : exprBenchPairs) {
+        // Same result from random cubes first, the drawings read both the cube and the other one.
+        for (int i = 0; i < 100; i++) {
+            Cube eager, fused, other;
+            randomCube(rng, eager);
+            randomCube(rng, other);
+            fused = eager;
+            p.eager(eager, other);
+            p.fused(fused, other);
+            Frame a, b;
+            eager.read(a);
+            fused.read(b);
+            if (memcmp(&a, &b, sizeof(a))) {
+                fprintf(stderr, "%s: fused expression differs from the eager drawing\n", p.name);
+                return 1;
+            }
+        }
+
+        Cube cube, other;
+        randomCube(rng, other);
+        const double eager = timeDrawing(p.eager, cube, other, iterations);
+        const double fused = timeDrawing(p.fused, cube, other, iterations);
+        printf("%-16s: %6.0fns eager, %5.0fns fused, %.1fx\n", p.name, eager, fused, eager / fused);
+    }
+    return 0;
+}
+
+// Effects without randomness, candidates for `ledcube bake`. Same names and arguments as in playlist.cpp,
+// in their own namespace as the playlist factories may be the cached ones.
+namespace live {
+EFFECT_FACTORY(voxelExplorer, VoxelExplorer, 100);
+EFFECT_FACTORY(planeBoing, PlaneBoing, 100);
+EFFECT_FACTORY(fullyOn, FullyOn);
+EFFECT_FACTORY(woopWoop, WoopWoop, 100);
+EFFECT_FACTORY(sineWave, SineWave, 20);
+EFFECT_FACTORY(ripple, Ripple, 20);
+EFFECT_FACTORY(plasma, Plasma, 20);
+}  // namespace live
+
+static const struct {
+    const char* name;
+    EffectEntry entry;
+} bakeCandidates[] = {
+    {"voxelExplorer", EFFECT_ENTRY(live::voxelExplorer)},
+    {"planeBoing", EFFECT_ENTRY(live::planeBoing)},
+    {"fullyOn", EFFECT_ENTRY(live::fullyOn)},
+    {"woopWoop", EFFECT_ENTRY(live::woopWoop)},
+    {"sineWave", EFFECT_ENTRY(live::sineWave)},
+    {"ripple", EFFECT_ENTRY(live::ripple)},
+    {"plasma", EFFECT_ENTRY(live::plasma)},
+};
+
+// Frames of an effect from a clear cube, as the cycler starts it: after init, then after each step.
+static void runFrames(const EffectEntry& entry, unsigned long seed, std::vector<Frame>& frames) {
+    std::vector<uint64_t> mem(entry.size / sizeof(uint64_t) + 1);
+    IEffect* effect = entry.create(mem.data());
+    Rng rng(seed);
+    effect->attach(rng);
+
+    Cube cube;
+    for (size_t i = 0; i < frames.size(); i++) {
+        if (i) {
+            effect->step(cube);
+        } else {
+            effect->init(cube);
+        }
+        cube.read(frames[i]);
+    }
+    effect->~IEffect();
+}
+
+// Append the record turning from into to, see BakedFrames.
+static void encodeRecord(const Frame& from, const Frame& to, std::vector<uint8_t>& out) {
+    const size_t head = out.size();
+    out.push_back(0);
+    for (int z = 0; z < 8; z++) {
+        uint8_t rows = 0;
+        for (int x = 0; x < 8; x++) {
+            rows |= (from.rows[z][x] != to.rows[z][x]) << x;
+        }
+        if (!rows) {
+            continue;
+        }
+        out[head] |= 1 << z;
+        out.push_back(rows);
+        for (int x = 0; x < 8; x++) {
+            if (rows >> x & 1) {
+                out.push_back(from.rows[z][x] ^ to.rows[z][x]);
+            }
+        }
+    }
+}
+
+// "voxelExplorer" -> "VOXEL_EXPLORER".
+static std::string macroName(const char* name) {
+    std::string s;
+    for (const char* p = name; *p; p++) {
+        if (isupper(*p) && p != name) {
+            s += '_';
+        }
+        s += toupper(*p);
+    }
+    return s;
+}
+
+// Run the deterministic effects for one full period and write their frames as flash tables replayed by
+// CachedEffect, smallest cost per ns saved first so a flash budget keeps the best ones.
+static int bake(const char* path, int maxFrames, int steps) {
+    struct Baked {
+        const char* name;
+        int lead, cycle;
+        std::vector<uint8_t> data;
+        uint16_t wrap, loop;
+        double liveNs, cachedNs;
+    };
+    std::vector<Baked> baked;
+
+    // Enough frames to check the cycle repeats at least twice.
+    const size_t count = 3 * maxFrames;
+    for (const auto& c : bakeCandidates) {
+        std::vector<Frame> frames(count), other(count);
+        runFrames(c.entry, 1, frames);
+        runFrames(c.entry, 2, other);
+        if (frames != other) {
+            printf("%-14s: depends on the random generator, left live\n", c.name);
+            continue;
+        }
+
+        // Shortest lead in and cycle.
+        int lead = 0, cycle = 0;
+        for (int p = 1; p <= maxFrames; p++) {
+            int l = count - p;
+            while (l > 0 && frames[l - 1] == frames[l - 1 + p]) {
+                l--;
+            }
+            if (l + p <= maxFrames && (!cycle || l + p < lead + cycle)) {
+                lead = l;
+                cycle = p;
+            }
+        }
+        if (!cycle) {
+            printf("%-14s: no cycle within %d frames, left live\n", c.name, maxFrames);
+            continue;
+        }
+
+        Baked b = {c.name, lead, cycle, {}, 0, 0, 0, 0};
+        const int n = lead + cycle;
+        std::vector<size_t> offsets;
+        Frame prev;
+        prev.clear();
+        for (int i = 0; i < n; i++) {
+            offsets.push_back(b.data.size());
+            encodeRecord(prev, frames[i], b.data);
+            prev = frames[i];
+        }
+        offsets.push_back(b.data.size());
+        encodeRecord(frames[n - 1], frames[lead], b.data);
+        if (b.data.size() > 0xffff) {
+            printf("%-14s: %zu bytes, too large for the table offsets, left live\n", c.name, b.data.size());
+            continue;
+        }
+        b.wrap = offsets[n];
+        b.loop = offsets[lead + 1];
+
+        // The replay must be the very same frames.
+        CachedEffect cached({b.data.data(), b.wrap, b.loop}, 1);
+        Cube cube;
+        for (size_t i = 0; i < count; i++) {
+            if (i) {
+                cached.step(cube);
+            } else {
+                cached.init(cube);
+            }
+            Frame f;
+            cube.read(f);
+            if (f != frames[i]) {
+                fprintf(stderr, "%s: replay differs at frame %zu\n", c.name, i);
+                return 1;
+            }
+        }
+
+        std::vector<uint64_t> mem(c.entry.size / sizeof(uint64_t) + 1);
+        IEffect* effect = c.entry.create(mem.data());
+        b.liveNs = timeSteps(*effect, steps);
+        effect->~IEffect();
+        b.cachedNs = timeSteps(cached, steps);
+        if (b.cachedNs >= b.liveNs) {
+            printf("%-14s: lead %d, cycle %d, replay no faster, %.0fns/step vs %.0fns live, left live\n", c.name, lead, cycle,
+                   b.cachedNs, b.liveNs);
+            continue;
+        }
+        baked.push_back(b);
+    }
+
+    // Smallest tables first, so the budget keeps as many effects as it can. Host step times vary between
+    // runs, ordering by them would shuffle the tables the budget keeps from a bake to the next.
+    std::sort(baked.begin(), baked.end(), [](const Baked& a, const Baked& b) {
+        return a.data.size() != b.data.size() ? a.data.size() < b.data.size() : strcmp(a.name, b.name) < 0;
+    });
+
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        perror(path);
+        return 1;
+    }
+    fprintf(out, "#pragma once\n\n// Generated by `ledcube bake %s %d %d`, do not edit.\n//\n", path, maxFrames, steps);
+    fprintf(out, "// Smallest tables first. A table is kept when it fits in what the previous ones left of\n");
+    fprintf(out, "// BAKED_FLASH_BUDGET, BAKED_BYTES_<n> being their total. Step times are measured on the host only,\n");
+    fprintf(out, "// they just leave out the effects whose replay is no faster and are not listed here.\n");
+    fprintf(out, "// %-14s %5s %6s %6s\n", "effect", "lead", "cycle", "bytes");
+    for (const Baked& b : baked) {
+        fprintf(out, "// %-14s %5d %6d %6zu\n", b.name, b.lead, b.cycle, b.data.size());
+    }
+    fprintf(out, "\n#include <Arduino.h>\n\n#include \"cachedeffect.h\"\n\n#define BAKED_BYTES_0 0\n");
+
+    printf("%-14s %5s %6s %6s %6s %8s %8s\n", "effect", "lead", "cycle", "raw", "bytes", "live ns", "table ns");
+    for (size_t i = 0; i < baked.size(); i++) {
+        const Baked& b = baked[i];
+        printf("%-14s %5d %6d %6d %6zu %8.0f %8.0f\n", b.name, b.lead, b.cycle, (b.lead + b.cycle) * 64, b.data.size(),
+               b.liveNs, b.cachedNs);
+
+        const std::string symbol = std::string("baked") + (char)toupper(b.name[0]) + (b.name + 1);
+        fprintf(out, "\n#if BAKED_FLASH_BUDGET >= BAKED_BYTES_%zu + %zu\n#define BAKED_%s\n", i, b.data.size(), macroName(b.name).c_str());
+        fprintf(out, "#define BAKED_BYTES_%zu (BAKED_BYTES_%zu + %zu)\n", i + 1, i, b.data.size());
+        fprintf(out, "static const uint8_t %sData[] PROGMEM = {", symbol.c_str());
+        for (size_t j = 0; j < b.data.size(); j++) {
+            fprintf(out, "%s0x%02x,", j % 12 ? " " : "\n    ", b.data[j]);
+        }
+        fprintf(out, "\n};\nconstexpr BakedFrames %s = {%sData, %u, %u};\n", symbol.c_str(), symbol.c_str(), b.wrap, b.loop);
+        fprintf(out, "#else\n#define BAKED_BYTES_%zu BAKED_BYTES_%zu\n#endif\n", i + 1, i);
+    }
+    fclose(out);
+    return 0;
+}
+
+static Metrics metrics;
+static MetricsGauges metricsGauges;
+static HostWebServer* metricsServer;
+static MetricsSender<HostClient> metricsSender;
+
+// Same route as in wifi.cpp, heap and WiFi values are unknown on the host and left to 0.
+static void handleMetrics() {
+    if (metricsSender.busy()) {
+        metricsServer->send(503, "text/plain", "scrape in progress\n", 19);
+        return;
+    }
+    metricsServer->setContentLength(metricsSender.start(metrics, metricsGauges, metricsServer->client()));
+    metricsServer->send(200, "text/plain; version=0.0.4", "", 0);
+}
+
+static bool drainLog() {
+    return logger.drain(Serial);
+}
+
+static unsigned long elapsedMicros(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+// Run the playlist through the governor with the metrics of the ESP8266 loop. The effects timings are
+// real, as the virtual clock doesn't move while they run. When serving, the virtual clock is paced on
+// the wall clock so the page is scraped live.
+static int serveMetrics(unsigned long seconds, uint16_t port, unsigned long seed) {
+    HostWebServer server(port);
+    if (port) {
+        if (!server.begin()) {
+            return 1;
+        }
+        server.on("/metrics", handleMetrics);
+        metricsServer = &server;
+        fprintf(stderr, "serving http://localhost:%u/metrics for %lus\n", port, seconds);
+    }
+
+    Cube cube;
+    ShiftPulseBoard board(SCK, SS, MOSI);
+    Governor governor(board, 100);
+    governor.setIdle(drainLog);
+    EffectCycler cycler(10000, registry);
+
+    native::setMicros(0);
+    registry.rng().seed(seed);
+    board.setup();
+    cycler = 0;
+    cycler.current()->init(cube);
+
+    const auto wallStart = std::chrono::steady_clock::now();
+    while (::micros() < seconds * 1000000ULL) {
+        const auto workStart = std::chrono::steady_clock::now();
+        const unsigned long currentTime = ::millis();
+        if (port) {
+            server.handleClient();
+            metricsSender.send();
+        }
+
+        cycler.loop(currentTime, cube);
+        const auto effectStart = std::chrono::steady_clock::now();
+        cycler.current()->loop(currentTime, cube);
+        const auto workEnd = std::chrono::steady_clock::now();
+        metrics.effect(cycler.index(), elapsedMicros(effectStart, workEnd));
+        metrics.loop(::micros(), elapsedMicros(workStart, workEnd));
+
+        metricsGauges.fps = governor.fps();
+        metricsGauges.framesDropped = governor.framesDropped();
+        metricsGauges.inputDropped = AudioInput::active() ? AudioInput::active()->overruns() : 0;
+        metricsGauges.effect = cycler.index();
+
+        governor.frame(cube);
+        if (port) {
+            std::this_thread::sleep_until(wallStart + std::chrono::microseconds(::micros()));
+        }
+    }
+    if (port) {
+        return 0;
+    }
+
+    static char page[METRICS_PAGE_SIZE];
+    const int iterations = 1000;
+    const auto start = std::chrono::steady_clock::now();
+    size_t len = 0;
+    for (int i = 0; i < iterations; i++) {
+        len = metrics.format(page, sizeof(page), metricsGauges);
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+    fwrite(page, 1, len, stdout);
+    fprintf(stderr, "%zu of %d bytes formatted in %.0fns\n", len, METRICS_PAGE_SIZE, ns);
+    return 0;
+}
+
+// Wiring of the cube controller, as in main.cpp, and the same as a per voxel mapping.
+static constexpr Wiring controllerWiring = {{1, 0, 3, 2, 5, 4, 7, 6}, 0xaa, true};
+
+static int controllerVoxel(const ICubeRO& cube, int x, int y, int z) {
+    if (x % 2 == 0) {
+        return cube.getVoxel(x + 1, y, 7 - z);
+    }
+    return cube.getVoxel(x - 1, 7 - y, 7 - z);
+}
+
+// Shift register board keeping the shifted bytes.
+class RecordingShiftBoard : public IShiftBoard {
+   public:
+    RecordingShiftBoard() : IShiftBoard(SCK, SS, MOSI) {}
+
+    void shift(uint8_t line) const {
+        this->_shifted.push_back(line);
+    }
+
+    mutable std::vector<uint8_t> _shifted;
+};
+
+// Render random cubes to the given number of outputs, each board with the controller mapping then
+// through a fan out board with the controller wiring. Both must shift the same bytes.
+static int fanOutBench(int outputs, int iterations) {
+    std::vector<RecordingShiftBoard> mapped(outputs), fanned(outputs);
+    FanOutBoard<8> fanOut;
+    if (outputs < 1 || outputs > 8) {
+        fprintf(stderr, "1 to 8 outputs\n");
+        return 1;
+    }
+    for (int i = 0; i < outputs; i++) {
+        mapped[i].setMapping(controllerVoxel);
+        fanOut.setOutput(i, fanned[i], &controllerWiring);
+    }
+
+    Rng rng(42);
+    std::vector<Cube> cubes(64);
+    for (Cube& cube : cubes) {
+        randomCube(rng, cube);
+    }
+    for (const Cube& cube : cubes) {
+        for (int i = 0; i < outputs; i++) {
+            mapped[i]._shifted.clear();
+            fanned[i]._shifted.clear();
+            mapped[i].render(cube);
+        }
+        fanOut.render(cube);
+        for (int i = 0; i < outputs; i++) {
+            if (mapped[i]._shifted != fanned[i]._shifted) {
+                fprintf(stderr, "output %d: the fan out board shifts different bytes\n", i);
+                return 1;
+            }
+        }
+    }
+
+    // Timings on boards shifting nowhere, only the serialization differs.
+    std::vector<ShiftPulseBoard> timedMapped(outputs, ShiftPulseBoard(SCK, SS, MOSI));
+    std::vector<ShiftPulseBoard> timedFanned(outputs, ShiftPulseBoard(SCK, SS, MOSI));
+    FanOutBoard<8> timedFanOut;
+    for (int i = 0; i < outputs; i++) {
+        timedMapped[i].setMapping(controllerVoxel);
+        timedFanOut.setOutput(i, timedFanned[i], &controllerWiring);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        for (int i = 0; i < outputs; i++) {
+            timedMapped[i].render(cubes[n & 63]);
+        }
+    }
+    const double separate = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+    start = std::chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        timedFanOut.render(cubes[n & 63]);
+    }
+    const double shared = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+    printf("%d output%s: %6.0fns/frame mapped boards, %5.0fns/frame fan out\n", outputs, outputs > 1 ? "s" : " ", separate, shared);
+    return 0;
+}
+
+static SimulatedSerial* tapSerial;
+static FrameTap* tapTap;
+
+// Same idle task as the firmware, see drainSerial in main.cpp.
+static bool drainTapSerial() {
+    if (tapTap && (tapTap->busy() || !logger.pending())) {
+        return tapTap->drain(*tapSerial);
+    }
+    return logger.drain(*tapSerial);
+}
+
+// Takes everything, to empty the log between runs.
+class NullPrint : public Print {
+   public:
+    size_t write(uint8_t) { return 1; }
+    int availableForWrite() { return 1 << 16; }
+};
+
+struct TapRun {
+    unsigned long frames;
+    uint16_t minFps;
+    uint32_t dropped;
+    unsigned long long blocked;
+};
+
+// Run the firmware loop over the playlist for the given virtual time, with the tap when given, keeping
+// every captured frame.
+static TapRun runTap(unsigned long seconds, unsigned long baud, unsigned long seed, FrameTap* tap, std::vector<Frame>& captured, std::vector<uint8_t>& output) {
+    NullPrint discard;
+    while (logger.drain(discard)) {
+    }
+
+    SimulatedSerial serial(baud);
+    tapSerial = &serial;
+    tapTap = tap;
+
+    Cube cube;
+    ShiftPulseBoard board(SCK, SS, MOSI);
+    Governor governor(board, 100);
+    governor.setIdle(drainTapSerial);
+    EffectCycler cycler(10000, registry);
+
+    native::setMicros(0);
+    registry.rng().seed(seed);
+    board.setup();
+    cycler = 0;
+    cycler.current()->init(cube);
+
+    TapRun run = {0, 0xffff, 0, 0};
+    while (::micros() < seconds * 1000000ULL) {
+        const unsigned long currentTime = ::millis();
+        cycler.loop(currentTime, cube);
+        cycler.current()->loop(currentTime, cube);
+        if (tap) {
+            tap->capture(cube, cycler.index(), currentTime);
+            Frame frame;
+            cube.read(frame);
+            captured.push_back(frame);
+        }
+        governor.frame(cube);
+        run.frames++;
+        // The first second has no full count yet.
+        if (::micros() > 1000000UL && governor.fps() < run.minFps) {
+            run.minFps = governor.fps();
+        }
+    }
+    run.dropped = governor.framesDropped();
+    run.blocked = serial.blockedMicros();
+    output = serial.output();
+    tapTap = 0;
+    return run;
+}
+
+// Check the frame tap doesn't slow the display down: the governor must show the same frames with the
+// tap on a simulated link of the given speed as without it. Then decode what went out on the link,
+// check the records against the captured frames and save them as a trace.
+static int tapSim(unsigned long seconds, const char* path, unsigned long baud, unsigned long seed) {
+    std::vector<uint8_t> output;
+    std::vector<Frame> captured;
+    const TapRun off = runTap(seconds, baud, seed, 0, captured, output);
+    FrameTap tap;
+    const TapRun on = runTap(seconds, baud, seed, &tap, captured, output);
+
+    printf("tap off: %lu frames, min %u fps, %u dropped, %lluus blocked on Serial\n", off.frames, off.minFps, off.dropped, off.blocked);
+    printf("tap on:  %lu frames, min %u fps, %u dropped, %lluus blocked on Serial\n", on.frames, on.minFps, on.dropped, on.blocked);
+
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return 1;
+    }
+    TraceRecorder recorder(out);
+    recorder.setup();
+    Cube cube;
+    TapDecoder decoder;
+    unsigned long records = 0, lines = 0, mismatches = 0;
+    for (uint8_t b : output) {
+        if (decoder.feed(b)) {
+            const TapDecoder::Record& r = decoder.record();
+            if (r.frame >= captured.size() || !(r.cube == captured[r.frame])) {
+                mismatches++;
+            }
+            records++;
+            cube.write(r.cube);
+            native::setMicros(r.time * 1000ULL);
+            recorder.render(cube);
+        } else if (decoder.lineReady()) {
+            lines++;
+        }
+    }
+    fclose(out);
+    printf("%lu records, %lu frames skipped, %lu log lines, %lu corrupted, %lu mismatches, %zu bytes\n",
+           records, (unsigned long)tap.skipped(), lines, decoder.corrupted(), mismatches, output.size());
+
+    if (on.frames != off.frames || on.minFps < off.minFps || on.dropped != off.dropped || on.blocked) {
+        fprintf(stderr, "the tap slows the display down\n");
+        return 1;
+    }
+    if (!records || mismatches || decoder.corrupted()) {
+        fprintf(stderr, "the tapped frames don't match the displayed ones\n");
+        return 1;
+    }
+    return 0;
+}
+
+// Decode a frame tap stream, printing the log lines on stderr and, when live, each frame as it comes.
+static int tapDecode(const char* input, const char* path, bool live) {
+    FILE* in = fopen(input, "rb");
+    if (!in) {
+        perror(input);
+        return 1;
+    }
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        fclose(in);
+        return 1;
+    }
+    TraceRecorder recorder(out);
+    recorder.setup();
+    TerminalBoard terminal;
+    Cube cube;
+    TapDecoder decoder;
+    for (int c; (c = fgetc(in)) != EOF;) {
+        if (decoder.feed(c)) {
+            const TapDecoder::Record& r = decoder.record();
+            cube.write(r.cube);
+            native::setMicros(r.time * 1000ULL);
+            recorder.render(cube);
+            // Recording a device doesn't end on its own, keep the trace usable at any time.
+            fflush(out);
+            if (live) {
+                printf("effect #%u, frame %u\n", r.effect, r.frame);
+                terminal.render(cube);
+                fflush(stdout);
+            }
+        } else if (decoder.lineReady()) {
+            fprintf(stderr, "%s\n", decoder.line());
+        }
+    }
+    fclose(in);
+    fclose(out);
+    fprintf(stderr, "%lu records, %lu frames skipped, %lu corrupted\n", recorder.records(), decoder.skipped(), decoder.corrupted());
+    return 0;
+}
+
+// Parse a list of effects such as "0,3,5-7", false if malformed or out of range.
+static bool parseEffects(const char* list, std::vector<int>& effects) {
+    for (const char* p = list; *p;) {
+        char* end;
+        const long first = strtol(p, &end, 10);
+        long last = first;
+        if (end == p) {
+            return false;
+        }
+        if (*end == '-') {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+            if (end == p) {
+                return false;
+            }
+        }
+        if (first < 0 || last < first || last >= playlistSize) {
+            return false;
+        }
+        for (long i = first; i <= last; i++) {
+            effects.push_back(i);
+        }
+        if (*end && *end != ',') {
+            return false;
+        }
+        p = *end ? end + 1 : end;
+    }
+    return !effects.empty();
+}
+
+struct PreviewResult {
+    unsigned long frames;
+    unsigned long files;
+    double seconds;
+    bool ok;
+};
+
+// Render the given effects with a pool of threads, each rendering one effect at a time.
+// Every thread has its own arena, registry, random generator, cube and virtual clock,
+// so the output doesn't depend on the number of threads and matches `record` for the same seed.
+static int preview(const char* dir, unsigned long seconds, const std::vector<int>& effects, unsigned int threads,
+                   unsigned long interval, unsigned long seed, bool png) {
+    std::vector<PreviewResult> results(effects.size());
+    std::atomic<size_t> next(0);
+
+    auto worker = [&]() {
+        std::unique_ptr<uint64_t[]> arena(new uint64_t[(playlistArenaSize + 7) / 8]);
+        EffectRegistry local(playlist, playlistSize, arena.get(), playlistArenaSize);
+
+        for (size_t i; (i = next++) < effects.size();) {
+            auto start = std::chrono::steady_clock::now();
+            PreviewBoard board(interval);
+            local.rng().seed(seed);
+            runEffect(local.activate(effects[i]), seconds, board);
+
+            char path[512];
+            PreviewResult& result = results[i];
+            result.frames = board.frames().size();
+            if (png) {
+                snprintf(path, sizeof(path), "%s/effect-%d", dir, effects[i]);
+                result.files = writePngs(path, board);
+                result.ok = result.files > 0;
+            } else {
+                snprintf(path, sizeof(path), "%s/effect-%d.gif", dir, effects[i]);
+                result.files = 1;
+                result.ok = writeGif(path, board);
+            }
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (unsigned int t = 1; t < threads && t < effects.size(); t++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : pool) {
+        t.join();
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    int err = 0;
+    for (size_t i = 0; i < effects.size(); i++) {
+        const PreviewResult& r = results[i];
+        printf("effect #%d: %lu frames, %lu files, %.3fs%s\n", effects[i], r.frames, r.files, r.seconds, r.ok ? "" : " FAILED");
+        err |= !r.ok;
+    }
+    printf("%zu effects in %.3fs with %u threads\n", effects.size(), elapsed, threads);
+    return err;
+}
+
+int main(int argc, char** argv) {
+    // Keep the effects chatter away from the tool output.
+    Serial.setOutput(stderr);
+
+    if (argc < 2) {
+        return usage();
+    }
+    const char* cmd = argv[1];
+
+    if (!strcmp(cmd, "list")) {
+        registry.report(Serial);
+        return 0;
+    }
+    if (!strcmp(cmd, "record") && argc >= 5) {
+        return record(atoi(argv[2]), strtoul(argv[3], 0, 10), argv[4], argc > 5 ? strtoul(argv[5], 0, 10) : 1);
+    }
+    if (!strcmp(cmd, "record-all") && argc >= 4) {
+        for (int i = 0; i < registry.size(); i++) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/effect-%d.trace", argv[2], i);
+            if (int err = record(i, strtoul(argv[3], 0, 10), path, argc > 4 ? strtoul(argv[4], 0, 10) : 1)) {
+                return err;
+            }
+        }
+        return 0;
+    }
+    if (!strcmp(cmd, "compare") && argc == 4) {
+        return compare(argv[2], argv[3]);
+    }
+    if (!strcmp(cmd, "replay") && argc == 3) {
+        return replayTrace(argv[2]);
+    }
+    if (!strcmp(cmd, "bench") && argc >= 3) {
+        return bench(argv[2], argc > 3 ? atoi(argv[3]) : 100);
+    }
+    if (!strcmp(cmd, "audio") && argc == 3) {
+        return audio(argv[2]);
+    }
+    if (!strcmp(cmd, "asm") && argc >= 4) {
+        return assembleFile(argv[2], argv[3], argc > 4 ? argv[4] : 0);
+    }
+    if (!strcmp(cmd, "vm") && argc >= 5) {
+        return recordProgram(argv[2], strtoul(argv[3], 0, 10), argv[4], argc > 5 ? strtoul(argv[5], 0, 10) : 1);
+    }
+    if (!strcmp(cmd, "vm-bench")) {
+        return vmBench(argc > 2 ? atoi(argv[2]) : 100000);
+    }
+    if (!strcmp(cmd, "expr-bench")) {
+        return exprBench(argc > 2 ? atoi(argv[2]) : 100000);
+    }
+    if (!strcmp(cmd, "fanout-bench")) {
+        return fanOutBench(argc > 2 ? atoi(argv[2]) : 2, argc > 3 ? atoi(argv[3]) : 100000);
+    }
+    if (!strcmp(cmd, "bake") && argc >= 3) {
+        return bake(argv[2], argc > 3 ? atoi(argv[3]) : 1024, argc > 4 ? atoi(argv[4]) : 100000);
+    }
+    if (!strcmp(cmd, "tap-sim") && argc >= 4) {
+        return tapSim(strtoul(argv[2], 0, 10), argv[3], argc > 4 ? strtoul(argv[4], 0, 10) : 9600, argc > 5 ? strtoul(argv[5], 0, 10) : 1);
+    }
+    if (!strcmp(cmd, "tap") && argc >= 4) {
+        return tapDecode(argv[2], argv[3], argc > 4 && !strcmp(argv[4], "--live"));
+    }
+    if (!strcmp(cmd, "metrics") && argc >= 3) {
+        return serveMetrics(strtoul(argv[2], 0, 10), argc > 3 ? atoi(argv[3]) : 0, argc > 4 ? strtoul(argv[4], 0, 10) : 1);
+    }
+    if (!strcmp(cmd, "preview") && argc >= 4) {
+        std::vector<int> effects;
+        unsigned int threads = std::thread::hardware_concurrency();
+        unsigned long interval = 40, seed = 1;
+        bool png = false;
+        for (int i = 4; i < argc; i++) {
+            const bool value = i + 1 < argc;
+            if (!strcmp(argv[i], "-e") && value) {
+                if (!parseEffects(argv[++i], effects)) {
+                    fprintf(stderr, "invalid effects: %s\n", argv[i]);
+                    return 2;
+                }
+            } else if (!strcmp(argv[i], "-j") && value) {
+                threads = atoi(argv[++i]);
+            } else if (!strcmp(argv[i], "-r") && value) {
+                interval = strtoul(argv[++i], 0, 10);
+            } else if (!strcmp(argv[i], "-s") && value) {
+                seed = strtoul(argv[++i], 0, 10);
+            } else if (!strcmp(argv[i], "--png")) {
+                png = true;
+            } else {
+                return usage();
+            }
+        }
+        if (effects.empty()) {
+            for (int i = 0; i < playlistSize; i++) {
+                effects.push_back(i);
+            }
+        }
+        // GIF delays are in centiseconds and viewers slow down anything below 2.
+        if (interval < 20) {
+            fprintf(stderr, "sampling interval must be at least 20ms\n");
+            return 2;
+        }
+        return preview(argv[2], strtoul(argv[3], 0, 10), effects, threads ? threads : 1, interval, seed, png);
+    }
+    if (!strcmp(cmd, "life")) {
+        return life(argc > 2 ? atoi(argv[2]) : 1000, argc > 3 ? strtoul(argv[3], 0, 10) : 1);
+    }
+    return usage();
+}
+
+#endif
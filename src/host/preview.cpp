@@ -0,0 +1,350 @@
+#ifdef NATIVE
+
+#include "preview.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+
+// Background, unlit voxel, lit voxel outline and core, as RGB.
+static const uint8_t palette[4][3] = {
+    {12, 12, 20},
+    {56, 56, 72},
+    {0, 96, 200},
+    {160, 224, 255},
+};
+
+// Lit voxels are drawn as this 5x5 sprite of palette indices, 0 being transparent.
+static const uint8_t litSprite[5][5] = {
+    {0, 2, 2, 2, 0},
+    {2, 3, 3, 3, 2},
+    {2, 3, 3, 3, 2},
+    {2, 3, 3, 3, 2},
+    {0, 2, 2, 2, 0},
+};
+
+// Screen position of the center of a voxel.
+static void isometric(int x, int y, int z, int& u, int& v) {
+    u = PREVIEW_WIDTH / 2 + (x - y) * 8;
+    v = 72 + (x + y) * 4 - z * 9;
+}
+
+void project(const Frame& frame, Image& image) {
+    memset(image.pixels, 0, sizeof(image.pixels));
+
+    // Unlit voxels first so they never hide a lit one.
+    int u, v;
+    for (int z = 0; z < 8; z++) {
+        for (int x = 0; x < 8; x++) {
+            for (int y = 0; y < 8; y++) {
+                isometric(x, y, z, u, v);
+                image.pixels[v][u] = 1;
+            }
+        }
+    }
+
+    // Then back to front: the larger x + y, the closer to the viewer.
+    for (int depth = 0; depth < 15; depth++) {
+        for (int z = 0; z < 8; z++) {
+            for (int x = depth < 8 ? 0 : depth - 7; x <= depth && x < 8; x++) {
+                const int y = depth - x;
+                if (!frame.get(x, y, z)) {
+                    continue;
+                }
+                isometric(x, y, z, u, v);
+                for (int i = 0; i < 5; i++) {
+                    for (int j = 0; j < 5; j++) {
+                        if (litSprite[i][j]) {
+                            image.pixels[v + i - 2][u + j - 2] = litSprite[i][j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PreviewBoard::setup() const {
+    this->_next = ::millis();
+    this->_frames.clear();
+    this->_samples.clear();
+}
+
+void PreviewBoard::render(const ICubeRO& in) const {
+    if ((long)(::millis() - this->_next) < 0) {
+        return;
+    }
+    this->_next += this->_interval;
+
+    Cube scratch;
+    const ICubeRO& cube = this->oriented(in, scratch);
+
+    Frame frame;
+    if (this->_mapping) {
+        for (int z = 0; z < 8; z++) {
+            for (int x = 0; x < 8; x++) {
+                for (int y = 0; y < 8; y++) {
+                    frame.set(x, y, z, this->getVoxel(cube, x, y, z));
+                }
+            }
+        }
+    } else {
+        cube.read(frame);
+    }
+
+    if (!this->_frames.empty() && frame == this->_frames.back()) {
+        this->_samples.back()++;
+        return;
+    }
+    this->_frames.push_back(frame);
+    this->_samples.push_back(1);
+}
+
+// GifCodes packs the variable width LZW codes LSB first into 255 bytes sub-blocks.
+class GifCodes {
+   public:
+    GifCodes(FILE* out) : _out(out) {}
+
+    void write(uint16_t code, uint8_t width) {
+        this->_bits |= (uint32_t)code << this->_count;
+        this->_count += width;
+        while (this->_count >= 8) {
+            this->byte(this->_bits);
+            this->_bits >>= 8;
+            this->_count -= 8;
+        }
+    }
+
+    // Flush the pending bits and write the block terminator.
+    void finish() {
+        if (this->_count) {
+            this->byte(this->_bits);
+        }
+        if (this->_size) {
+            fputc(this->_size, this->_out);
+            fwrite(this->_block, 1, this->_size, this->_out);
+        }
+        fputc(0, this->_out);
+    }
+
+   private:
+    void byte(uint8_t b) {
+        this->_block[this->_size++] = b;
+        if (this->_size == 255) {
+            fputc(this->_size, this->_out);
+            fwrite(this->_block, 1, this->_size, this->_out);
+            this->_size = 0;
+        }
+    }
+
+   private:
+    FILE* _out;
+    uint32_t _bits = 0;
+    uint8_t _count = 0;
+    uint8_t _block[255];
+    uint8_t _size = 0;
+};
+
+// LZW compress the image with 2 bits minimum code size, as GIF image data.
+static void writeGifImage(FILE* out, const Image& image) {
+    const uint16_t clearCode = 4, endCode = 5;
+    // Code of each string extended by each of the 4 colors, 0 when not in the table yet.
+    static thread_local uint16_t table[4096][4];
+
+    fputc(2, out);
+    GifCodes codes(out);
+
+    uint16_t next = 6;
+    uint8_t width = 3;
+    memset(table, 0, sizeof(table));
+    codes.write(clearCode, width);
+
+    const uint8_t* pixels = &image.pixels[0][0];
+    uint16_t current = pixels[0];
+    for (size_t i = 1; i < sizeof(image.pixels); i++) {
+        const uint8_t pixel = pixels[i];
+        if (table[current][pixel]) {
+            current = table[current][pixel];
+            continue;
+        }
+        codes.write(current, width);
+        if (next < 4096) {
+            // The decoder adds its entries one code late, it widens after reading the code following this one.
+            table[current][pixel] = next;
+            if (next++ == (1 << width)) {
+                width++;
+            }
+        } else {
+            codes.write(clearCode, width);
+            memset(table, 0, sizeof(table));
+            next = 6;
+            width = 3;
+        }
+        current = pixel;
+    }
+    codes.write(current, width);
+    codes.write(endCode, width);
+    codes.finish();
+}
+
+static void write16(FILE* out, uint16_t v) {
+    fputc(v & 0xff, out);
+    fputc(v >> 8, out);
+}
+
+bool writeGif(const char* path, const PreviewBoard& preview) {
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return false;
+    }
+
+    // Header and logical screen with a global color table of 4 entries.
+    fwrite("GIF89a", 1, 6, out);
+    write16(out, PREVIEW_WIDTH);
+    write16(out, PREVIEW_HEIGHT);
+    fputc(0x80 | (1 << 4) | 1, out);
+    fputc(0, out);
+    fputc(0, out);
+    fwrite(palette, 1, sizeof(palette), out);
+
+    // Loop forever.
+    static const uint8_t loop[] = {0x21, 0xff, 11, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0', 3, 1, 0, 0, 0};
+    fwrite(loop, 1, sizeof(loop), out);
+
+    // Delays are in centiseconds, computed from the start of each frame so the rounding errors don't add up.
+    Image image;
+    unsigned long sample = 0;
+    for (size_t i = 0; i < preview.frames().size(); i++) {
+        const unsigned long start = sample * preview.interval() / 10;
+        sample += preview.samples()[i];
+        const unsigned long end = sample * preview.interval() / 10;
+
+        const uint8_t control[] = {0x21, 0xf9, 4, 0, 0, 0, 0, 0};
+        fwrite(control, 1, 4, out);
+        write16(out, end - start > 0xffff ? 0xffff : end - start);
+        fwrite(control + 6, 1, 2, out);
+
+        fputc(0x2c, out);
+        write16(out, 0);
+        write16(out, 0);
+        write16(out, PREVIEW_WIDTH);
+        write16(out, PREVIEW_HEIGHT);
+        fputc(0, out);
+
+        project(preview.frames()[i], image);
+        writeGifImage(out, image);
+    }
+    fputc(0x3b, out);
+
+    const bool ok = !ferror(out);
+    fclose(out);
+    if (!ok) {
+        fprintf(stderr, "%s: write error\n", path);
+    }
+    return ok;
+}
+
+static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t len) {
+    static uint32_t table[256];
+    static bool ready = [] {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = c & 1 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+        return true;
+    }();
+    (void)ready;
+
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void put32(std::vector<uint8_t>& buf, uint32_t v) {
+    buf.push_back(v >> 24);
+    buf.push_back(v >> 16);
+    buf.push_back(v >> 8);
+    buf.push_back(v);
+}
+
+// Write a PNG chunk: length, type, data and the CRC of type and data.
+static void writeChunk(FILE* out, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    put32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    put32(chunk, crc32(0, chunk.data() + 4, chunk.size() - 4));
+    fwrite(chunk.data(), 1, chunk.size(), out);
+}
+
+static bool writePng(const char* path, const Image& image) {
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return false;
+    }
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    fwrite(signature, 1, sizeof(signature), out);
+
+    // 8 bits paletted.
+    std::vector<uint8_t> header;
+    put32(header, PREVIEW_WIDTH);
+    put32(header, PREVIEW_HEIGHT);
+    header.insert(header.end(), {8, 3, 0, 0, 0});
+    writeChunk(out, "IHDR", header);
+    writeChunk(out, "PLTE", std::vector<uint8_t>(&palette[0][0], &palette[0][0] + sizeof(palette)));
+
+    // Scanlines without filter, in stored deflate blocks of up to 65535 bytes within a zlib stream.
+    std::vector<uint8_t> raw;
+    for (int y = 0; y < PREVIEW_HEIGHT; y++) {
+        raw.push_back(0);
+        raw.insert(raw.end(), image.pixels[y], image.pixels[y] + PREVIEW_WIDTH);
+    }
+    std::vector<uint8_t> data = {0x78, 0x01};
+    for (size_t pos = 0; pos < raw.size();) {
+        const uint16_t len = raw.size() - pos > 0xffff ? 0xffff : raw.size() - pos;
+        data.push_back(pos + len == raw.size());
+        data.insert(data.end(), {(uint8_t)len, (uint8_t)(len >> 8), (uint8_t)~len, (uint8_t)(~len >> 8)});
+        data.insert(data.end(), raw.begin() + pos, raw.begin() + pos + len);
+        pos += len;
+    }
+    uint32_t a = 1, b = 0;
+    for (uint8_t c : raw) {
+        a = (a + c) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32(data, (b << 16) | a);
+    writeChunk(out, "IDAT", data);
+    writeChunk(out, "IEND", std::vector<uint8_t>());
+
+    const bool ok = !ferror(out);
+    fclose(out);
+    if (!ok) {
+        fprintf(stderr, "%s: write error\n", path);
+    }
+    return ok;
+}
+
+unsigned long writePngs(const char* prefix, const PreviewBoard& preview) {
+    Image image;
+    unsigned long n = 0;
+    for (size_t i = 0; i < preview.frames().size(); i++) {
+        project(preview.frames()[i], image);
+        for (unsigned long s = 0; s < preview.samples()[i]; s++, n++) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s-%04lu.png", prefix, n);
+            if (!writePng(path, image)) {
+                return 0;
+            }
+        }
+    }
+    return n;
+}
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "cube.h"
+#include "iboard.h"
+
+// Offline previews of the effects: an isometric view of the cube, written as animated GIFs or PNG sequences.
+// No external library, the GIF is LZW compressed and the PNGs use stored (uncompressed) deflate blocks.
+
+// Size of the projected images, in pixels.
+#define PREVIEW_WIDTH 136
+#define PREVIEW_HEIGHT 140
+
+// Image is a paletted picture of the cube, one palette index per pixel.
+struct Image {
+    uint8_t pixels[PREVIEW_HEIGHT][PREVIEW_WIDTH];
+};
+
+// Draw the frame in isometric projection: z goes up, x and y go down to the right and to the left.
+void project(const Frame& frame, Image& image);
+
+// PreviewBoard samples what the cube displays at a fixed rate of virtual time.
+// Consecutive identical samples are merged into one frame displayed longer.
+class PreviewBoard : public IBoard {
+   public:
+    PreviewBoard(unsigned long intervalMs) : _interval(intervalMs) {}
+
+    void setup() const;
+    void render(const ICubeRO& cube) const;
+
+    const std::vector<Frame>& frames() const { return this->_frames; }
+    // Number of samples each frame lasts.
+    const std::vector<unsigned long>& samples() const { return this->_samples; }
+    unsigned long interval() const { return this->_interval; }
+
+   private:
+    unsigned long _interval;
+    mutable unsigned long _next = 0;
+    mutable std::vector<Frame> _frames;
+    mutable std::vector<unsigned long> _samples;
+};
+
+// Write the sampled frames as a looping animated GIF, false with a message on stderr on failure.
+bool writeGif(const char* path, const PreviewBoard& preview);
+
+// Write one PNG per sample as <prefix>-<n>.png, returns the number of files written, 0 on failure.
+unsigned long writePngs(const char* prefix, const PreviewBoard& preview);
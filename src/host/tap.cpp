@@ -0,0 +1,96 @@
+#ifdef NATIVE
+
+#include "tap.h"
+
+void SimulatedSerial::update() {
+    const unsigned long long now = ::micros();
+    while (this->_queued && this->_lineFree <= now) {
+        this->_queued--;
+        if (this->_queued) {
+            this->_lineFree += this->_byteMicros;
+        }
+    }
+}
+
+size_t SimulatedSerial::write(uint8_t c) {
+    this->update();
+    if (this->_queued == bufferSize) {
+        // Wait for the byte on the line to go out.
+        const unsigned long long wait = this->_lineFree - ::micros();
+        this->_blocked += wait;
+        native::advanceMicros(wait);
+        this->update();
+    }
+    if (!this->_queued) {
+        this->_lineFree = ::micros() + this->_byteMicros;
+    }
+    this->_queued++;
+    this->_output.push_back(c);
+    return 1;
+}
+
+int SimulatedSerial::availableForWrite() {
+    native::advanceMicros(pollMicros);
+    this->update();
+    return bufferSize - this->_queued;
+}
+
+bool TapDecoder::feed(uint8_t b) {
+    this->_lineReady = false;
+
+    if (!this->_inRecord) {
+        if (this->_len == 1) {
+            this->_len = 0;
+            if (b == 0xcb) {
+                this->_inRecord = true;
+                this->_len = 2;
+                return false;
+            }
+        }
+        if (b == 0xfc) {
+            this->_buf[this->_len++] = b;
+            return false;
+        }
+        if (b == '\n') {
+            this->_line[this->_lineLen] = 0;
+            this->_lineLen = 0;
+            this->_lineReady = true;
+        } else if (b != '\r' && this->_lineLen < sizeof(this->_line) - 1) {
+            this->_line[this->_lineLen++] = b;
+        }
+        return false;
+    }
+
+    this->_buf[this->_len++] = b;
+    if (this->_len < FRAME_TAP_RECORD_SIZE) {
+        return false;
+    }
+    this->_inRecord = false;
+    this->_len = 0;
+
+    uint8_t sum = 0;
+    for (int i = 2; i < FRAME_TAP_RECORD_SIZE - 1; i++) {
+        sum += this->_buf[i];
+    }
+    if (sum != this->_buf[FRAME_TAP_RECORD_SIZE - 1]) {
+        this->_corrupted++;
+        return false;
+    }
+
+    const uint16_t frame = this->_buf[2] | this->_buf[3] << 8;
+    if (this->_started) {
+        const uint16_t delta = frame - this->_lastFrame;
+        this->_skipped += delta - 1;
+        this->_record.frame += delta;
+    } else {
+        this->_record.frame = frame;
+        this->_started = true;
+    }
+    this->_lastFrame = frame;
+    this->_record.time = (uint32_t)this->_buf[4] | (uint32_t)this->_buf[5] << 8 | (uint32_t)this->_buf[6] << 16 | (uint32_t)this->_buf[7] << 24;
+    this->_record.effect = this->_buf[8];
+    memcpy(this->_record.cube.rows, this->_buf + 9, sizeof(this->_record.cube.rows));
+    return true;
+}
+
+#endif
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+#include "frametap.h"
+
+// SimulatedSerial is a UART on the virtual clock: a TX buffer of the Uno size emptied at the given baud
+// rate. Like the Arduino one, writing to a full buffer waits, moving the virtual clock, so code blocking
+// on the link shows up in the frame timings. Polling for room takes a few us, as on the Uno.
+class SimulatedSerial : public Print {
+   public:
+    SimulatedSerial(unsigned long baud) : _byteMicros(10000000UL / baud) {}
+
+    size_t write(uint8_t c);
+    using Print::write;
+    int availableForWrite();
+
+    // Everything that went out on the line, including what is still in the buffer.
+    const std::vector<uint8_t>& output() const { return this->_output; }
+
+    // Virtual time spent waiting for room in the buffer.
+    unsigned long long blockedMicros() const { return this->_blocked; }
+
+   private:
+    // Move the bytes the line sent since the last call out of the buffer.
+    void update();
+
+   private:
+    static const int bufferSize = 64;
+    static const int pollMicros = 4;
+
+    unsigned long _byteMicros;
+    int _queued = 0;
+    unsigned long long _lineFree = 0;
+    unsigned long long _blocked = 0;
+    std::vector<uint8_t> _output;
+};
+
+// TapDecoder splits a Serial stream into the log lines and the FrameTap records, resyncing on garbage.
+class TapDecoder {
+   public:
+    struct Record {
+        // Frame number of the device, unwrapped past 16 bits.
+        uint32_t frame;
+        uint32_t time;
+        uint8_t effect;
+        Frame cube;
+    };
+
+    // Feed the next byte. Returns true when it completed a valid record, see record().
+    bool feed(uint8_t b);
+
+    const Record& record() const { return this->_record; }
+
+    // Complete log line, without the line ending, when feed returned false and lineReady is true.
+    bool lineReady() const { return this->_lineReady; }
+    const char* line() const { return this->_line; }
+
+    // Records dropped on a bad checksum, frames skipped by the device according to the frame numbers.
+    unsigned long corrupted() const { return this->_corrupted; }
+    unsigned long skipped() const { return this->_skipped; }
+
+   private:
+    uint8_t _buf[FRAME_TAP_RECORD_SIZE];
+    uint8_t _len = 0;
+    bool _inRecord = false;
+
+    char _line[256];
+    size_t _lineLen = 0;
+    bool _lineReady = false;
+
+    Record _record;
+    bool _started = false;
+    uint16_t _lastFrame = 0;
+    unsigned long _corrupted = 0;
+    unsigned long _skipped = 0;
+};
@@ -0,0 +1,111 @@
+#ifdef NATIVE
+
+#include "trace.h"
+
+#include <Arduino.h>
+
+static const char traceMagic[4] = {'L', 'C', 'T', 'R'};
+static const uint8_t traceVersion = 1;
+
+void TraceRecorder::setup() const {
+    fwrite(traceMagic, 1, sizeof(traceMagic), this->_out);
+    fputc(traceVersion, this->_out);
+}
+
+void TraceRecorder::render(const ICubeRO& in) const {
+    Cube scratch;
+    const ICubeRO& cube = this->oriented(in, scratch);
+
+    Frame frame;
+    if (this->_mapping) {
+        for (int z = 0; z < 8; z++) {
+            for (int x = 0; x < 8; x++) {
+                for (int y = 0; y < 8; y++) {
+                    frame.set(x, y, z, this->getVoxel(cube, x, y, z));
+                }
+            }
+        }
+    } else {
+        cube.read(frame);
+    }
+
+    // Nothing changed since the last record.
+    if (this->_records && frame == this->_last) {
+        return;
+    }
+
+    // Timestamp delta as a LEB128 varint.
+    unsigned long now = ::millis();
+    unsigned long delta = now - this->_lastTime;
+    do {
+        uint8_t b = delta & 0x7f;
+        delta >>= 7;
+        fputc(delta ? b | 0x80 : b, this->_out);
+    } while (delta);
+    fwrite(frame.rows, 1, sizeof(frame.rows), this->_out);
+
+    this->_last = frame;
+    this->_lastTime = now;
+    this->_records++;
+}
+
+TraceReader::TraceReader(FILE* in) : _in(in) {
+    char magic[sizeof(traceMagic)];
+    this->_valid = fread(magic, 1, sizeof(magic), in) == sizeof(magic) &&
+                   memcmp(magic, traceMagic, sizeof(magic)) == 0 &&
+                   fgetc(in) == traceVersion;
+}
+
+bool TraceReader::next(Frame& frame, unsigned long& timestamp) {
+    if (!this->_valid) {
+        return false;
+    }
+
+    unsigned long delta = 0;
+    int shift = 0;
+    int c;
+    do {
+        if ((c = fgetc(this->_in)) == EOF) {
+            return false;
+        }
+        delta |= (unsigned long)(c & 0x7f) << shift;
+        shift += 7;
+    } while (c & 0x80);
+
+    if (fread(frame.rows, 1, sizeof(frame.rows), this->_in) != sizeof(frame.rows)) {
+        return false;
+    }
+    this->_time += delta;
+    timestamp = this->_time;
+    return true;
+}
+
+unsigned long replay(TraceReader& trace, const IBoard& board, ICube& cube) {
+    Frame frame;
+    unsigned long timestamp;
+    unsigned long count = 0;
+
+    while (trace.next(frame, timestamp)) {
+        native::setMicros(timestamp * 1000ULL);
+        cube.write(frame);
+        board.render(cube);
+        count++;
+    }
+    return count;
+}
+
+void runEffect(IEffect* effect, unsigned long seconds, const IBoard& board) {
+    Cube cube;
+
+    native::setMicros(0);
+    effect->init(cube);
+
+    board.setup();
+    for (unsigned long long t = 0; t < seconds * 1000000ULL; t += tickMicros) {
+        native::setMicros(t);
+        effect->loop(::millis(), cube);
+        board.render(cube);
+    }
+}
+
+#endif
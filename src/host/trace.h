@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "cube.h"
+#include "iboard.h"
+#include "ieffect.h"
+
+// Frame traces record what the cube displayed over (virtual) time.
+//
+// File layout:
+//   "LCTR" magic, 1 byte version.
+//   Records: varint timestamp delta in ms since the previous record, followed by the 64 bytes packed frame.
+//
+// Consecutive identical frames are recorded once, a frame is displayed until the next record's timestamp.
+
+// TraceRecorder is a board writing each presented frame to a trace file.
+class TraceRecorder : public IBoard {
+   public:
+    TraceRecorder(FILE* out) : _out(out) {}
+
+    // Write the trace header.
+    void setup() const;
+    void render(const ICubeRO& cube) const;
+
+    // Number of records written.
+    unsigned long records() const { return this->_records; }
+
+   private:
+    FILE* _out;
+    mutable Frame _last;
+    mutable unsigned long _lastTime = 0;
+    mutable unsigned long _records = 0;
+};
+
+// TraceReader reads back the records of a trace file.
+class TraceReader {
+   public:
+    TraceReader(FILE* in);
+
+    // Whether the file is a trace we can read.
+    bool valid() const { return this->_valid; }
+
+    // Read the next record, returns false at the end of the trace.
+    bool next(Frame& frame, unsigned long& timestamp);
+
+   private:
+    FILE* _in;
+    bool _valid;
+    unsigned long _time = 0;
+};
+
+// Replay the trace into the given board through the given cube, moving the virtual clock to each record's timestamp.
+// Returns the number of frames rendered.
+unsigned long replay(TraceReader& trace, const IBoard& board, ICube& cube);
+
+// Virtual time between two loop iterations when running an effect.
+static const unsigned long tickMicros = 1000;
+
+// Run the given effect from a clear cube for the given virtual duration, rendering each loop to the board.
+void runEffect(IEffect* effect, unsigned long seconds, const IBoard& board);
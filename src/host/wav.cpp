@@ -0,0 +1,100 @@
+#ifdef NATIVE
+
+#include "wav.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio.h"
+
+static uint32_t readLE(const uint8_t* p, int size) {
+    uint32_t v = 0;
+    for (int i = size - 1; i >= 0; i--) {
+        v = v << 8 | p[i];
+    }
+    return v;
+}
+
+// Samples in [-1, 1] at their original rate.
+static bool loadWav(const char* path, std::vector<float>& pcm, uint32_t& rate) {
+    FILE* in = fopen(path, "rb");
+    if (!in) {
+        perror(path);
+        return false;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buf[4096];
+    for (size_t n; (n = fread(buf, 1, sizeof(buf), in)) > 0;) {
+        data.insert(data.end(), buf, buf + n);
+    }
+    fclose(in);
+
+    if (data.size() < 12 || memcmp(&data[0], "RIFF", 4) || memcmp(&data[8], "WAVE", 4)) {
+        fprintf(stderr, "%s: not a WAV file\n", path);
+        return false;
+    }
+
+    uint16_t format = 0, channels = 0, bits = 0;
+    for (size_t off = 12; off + 8 <= data.size();) {
+        const uint8_t* chunk = &data[off];
+        const uint32_t size = readLE(chunk + 4, 4);
+        const uint8_t* body = chunk + 8;
+        if (off + 8 + size > data.size()) {
+            break;
+        }
+        if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+            format = readLE(body, 2);
+            channels = readLE(body + 2, 2);
+            rate = readLE(body + 4, 4);
+            bits = readLE(body + 14, 2);
+        } else if (!memcmp(chunk, "data", 4)) {
+            if (format != 1 || !channels || (bits != 8 && bits != 16)) {
+                fprintf(stderr, "%s: only 8 and 16 bits PCM are supported\n", path);
+                return false;
+            }
+            const int width = bits / 8 * channels;
+            for (uint32_t i = 0; i + width <= size; i += width) {
+                float sum = 0;
+                for (int c = 0; c < channels; c++) {
+                    const uint8_t* s = body + i + c * bits / 8;
+                    sum += bits == 8 ? (s[0] - 128) / 128.f : (int16_t)readLE(s, 2) / 32768.f;
+                }
+                pcm.push_back(sum / channels);
+            }
+            return true;
+        }
+        off += 8 + size + (size & 1);
+    }
+    fprintf(stderr, "%s: no audio data\n", path);
+    return false;
+}
+
+bool loadAudio(const char* source, std::vector<uint16_t>& samples) {
+    std::vector<float> pcm;
+    uint32_t rate = AUDIO_SAMPLE_RATE;
+
+    if (!strncmp(source, "tone:", 5)) {
+        char* end;
+        const double hz = strtod(source + 5, &end);
+        const long ms = *end == ':' ? strtol(end + 1, 0, 10) : 1000;
+        for (long i = 0; i < ms * rate / 1000; i++) {
+            pcm.push_back(sin(2 * M_PI * hz * i / rate));
+        }
+    } else if (!loadWav(source, pcm, rate)) {
+        return false;
+    }
+
+    // Linear resampling to the ADC rate, then scaled to the 10 bits ADC range around its middle.
+    const double step = (double)rate / AUDIO_SAMPLE_RATE;
+    for (double pos = 0; pos + 1 < pcm.size(); pos += step) {
+        const size_t i = (size_t)pos;
+        const double v = pcm[i] + (pcm[i + 1] - pcm[i]) * (pos - i);
+        const long adc = lround(512 + v * 511);
+        samples.push_back(adc < 0 ? 0 : adc > 1023 ? 1023 : adc);
+    }
+    return true;
+}
+
+#endif
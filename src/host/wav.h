@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+// Audio sources for the ADC shim, as 10 bits ADC values sampled at AUDIO_SAMPLE_RATE.
+//
+// Sources:
+//   <file>.wav           PCM WAV, 8 or 16 bits, any rate, channels mixed down.
+//   tone:<hz>[:<ms>]     Full scale sine, 1s by default.
+
+// Load the given source, false with a message on stderr on failure.
+bool loadAudio(const char* source, std::vector<uint16_t>& samples);
@@ -0,0 +1,137 @@
+#ifdef NATIVE
+
+#include "webserver.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+HostClient::HostClient(int fd) : _socket(new Socket{fd}) {}
+
+HostClient::Socket::~Socket() {
+    if (this->fd >= 0) {
+        close(this->fd);
+    }
+}
+
+bool HostClient::connected() const {
+    return this->_socket && this->_socket->fd >= 0;
+}
+
+int HostClient::availableForWrite() const {
+    if (!this->connected()) {
+        return 0;
+    }
+    // A writable socket takes at least a segment.
+    pollfd fd = {this->_socket->fd, POLLOUT, 0};
+    return poll(&fd, 1, 0) > 0 && (fd.revents & POLLOUT) ? 1460 : 0;
+}
+
+size_t HostClient::write(const uint8_t* buf, size_t size) {
+    if (!this->connected()) {
+        return 0;
+    }
+    // No SIGPIPE when the client went away, the error is enough.
+    const ssize_t n = ::send(this->_socket->fd, buf, size, MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        perror("send");
+        close(this->_socket->fd);
+        this->_socket->fd = -1;
+        return 0;
+    }
+    return n;
+}
+
+HostWebServer::~HostWebServer() {
+    if (this->_listener >= 0) {
+        close(this->_listener);
+    }
+}
+
+bool HostWebServer::begin() {
+    this->_listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (this->_listener < 0) {
+        perror("socket");
+        return false;
+    }
+    const int yes = 1;
+    setsockopt(this->_listener, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(this->_port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(this->_listener, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(this->_listener, 4) < 0) {
+        perror("bind");
+        return false;
+    }
+    fcntl(this->_listener, F_SETFL, O_NONBLOCK);
+    return true;
+}
+
+void HostWebServer::on(const char* uri, handler h) {
+    this->_routes.push_back({uri, h});
+}
+
+void HostWebServer::handleClient() {
+    const int client = accept(this->_listener, 0, 0);
+    if (client < 0) {
+        return;
+    }
+    this->_client = HostClient(client);
+
+    // The request line is all we need, wait a bit for it as a real client sends it right away.
+    char request[1024];
+    size_t len = 0;
+    pollfd fd = {client, POLLIN, 0};
+    while (len < sizeof(request) - 1 && !memchr(request, '\n', len) && poll(&fd, 1, 1000) > 0) {
+        const ssize_t n = read(client, request + len, sizeof(request) - 1 - len);
+        if (n <= 0) {
+            break;
+        }
+        len += n;
+    }
+    request[len] = 0;
+
+    char method[8], uri[512];
+    if (sscanf(request, "%7s %511s", method, uri) != 2) {
+        this->send(400, "text/plain", "bad request\n", 12);
+    } else {
+        this->_uri = uri;
+        handler h = 0;
+        for (const Route& r : this->_routes) {
+            if (r.uri == this->_uri) {
+                h = r.h;
+            }
+        }
+        if (h) {
+            h();
+        } else {
+            this->send(404, "text/plain", "not found\n", 10);
+        }
+    }
+    this->_client = HostClient();
+}
+
+void HostWebServer::send(int code, const char* contentType, const char* content, size_t length) {
+    const size_t contentLength = this->_contentLength == (size_t)-1 ? length : this->_contentLength;
+    this->_contentLength = (size_t)-1;
+    char header[256];
+    const int n = snprintf(header, sizeof(header), "HTTP/1.0 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\n\r\n",
+                           code, code == 200 ? "OK" : "Error", contentType, contentLength);
+    // The headers and short replies fit the socket buffer of a new connection, longer content is sent by
+    // the handler over the next loops.
+    this->_client.write((const uint8_t*)header, n);
+    this->_client.write((const uint8_t*)content, length);
+}
+
+#endif
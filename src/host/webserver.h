@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// HostClient is a connection as WiFiClient is on the board: copies share the socket, closed with the last
+// one, so a handler can keep answering over the next loops.
+class HostClient {
+   public:
+    HostClient() {}
+    explicit HostClient(int fd);
+
+    bool connected() const;
+
+    // Bytes a write takes without blocking, 0 when the socket buffer is full.
+    int availableForWrite() const;
+
+    // Write without blocking, returns the bytes written. The connection closes on error.
+    size_t write(const uint8_t* buf, size_t size);
+
+   private:
+    struct Socket {
+        int fd;
+        ~Socket();
+    };
+
+    std::shared_ptr<Socket> _socket;
+};
+
+// HostWebServer is a stand-in for ESP8266WebServer on the host, with the subset of its API the routes use.
+// It reads one GET request at a time over HTTP/1.0 and never blocks: handleClient returns right away
+// when nobody is connecting, as on the board where it is called from the loop. The connection closes
+// after the handler unless it kept the client to send the content later.
+class HostWebServer {
+   public:
+    typedef void (*handler)();
+
+    HostWebServer(uint16_t port) : _port(port) {}
+    ~HostWebServer();
+
+    // Listen on localhost, false with a message on stderr on failure.
+    bool begin();
+
+    void on(const char* uri, handler h);
+
+    // Accept and answer a pending request, if any.
+    void handleClient();
+
+    void send(int code, const char* contentType, const char* content, size_t length);
+
+    // Content length of the next send, whose content then only has to begin it.
+    void setContentLength(size_t length) {
+        this->_contentLength = length;
+    }
+
+    HostClient client() const {
+        return this->_client;
+    }
+
+    const std::string& uri() const { return this->_uri; }
+
+   private:
+    struct Route {
+        std::string uri;
+        handler h;
+    };
+
+    uint16_t _port;
+    int _listener = -1;
+    HostClient _client;
+    size_t _contentLength = (size_t)-1;
+    std::string _uri;
+    std::vector<Route> _routes;
+};
@@ -0,0 +1,163 @@
+#include "log.h"
+
+Logger logger;
+
+static const char levelNames[] PROGMEM = "DIWE";
+static const char droppedFormat[] PROGMEM = "log: %u records dropped";
+
+// Record header: level in the high nibble, number of arguments in the low one, then the format pointer.
+static const uint8_t headerSize = 1 + sizeof(const char*);
+
+void Logger::push(uint8_t level, const char* format, const int32_t* args, uint8_t count) {
+    // Once full, keep dropping until the ring is printed so the drop report lands where the records are missing.
+    const uint8_t size = headerSize + count * sizeof(int32_t);
+    if (this->_unreported || this->used() + size >= LOG_RING_SIZE) {
+        this->_dropped++;
+        if (this->_unreported < 0xffff) {
+            this->_unreported++;
+        }
+        return;
+    }
+    const uint8_t header = (level << 4) | count;
+    this->write(&header, 1);
+    this->write(&format, sizeof(format));
+    this->write(args, count * sizeof(int32_t));
+}
+
+void Logger::write(const void* data, uint8_t size) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (uint8_t i = 0; i < size; i++) {
+        this->_ring[this->_head] = p[i];
+        this->_head = (this->_head + 1) & (LOG_RING_SIZE - 1);
+    }
+}
+
+void Logger::read(uint16_t at, void* data, uint8_t size) const {
+    uint8_t* p = (uint8_t*)data;
+    for (uint8_t i = 0; i < size; i++) {
+        p[i] = this->_ring[at];
+        at = (at + 1) & (LOG_RING_SIZE - 1);
+    }
+}
+
+// LineWriter formats a record into a line, truncated to LOG_LINE_SIZE with room for the line ending.
+class LineWriter {
+   public:
+    void put(char c) {
+        if (this->_len < sizeof(this->_buf) - 2) {
+            this->_buf[this->_len++] = c;
+        }
+    }
+
+    void number(uint32_t n, uint8_t base) {
+        char digits[10];
+        uint8_t i = 0;
+        do {
+            const uint8_t d = n % base;
+            digits[i++] = d < 10 ? '0' + d : 'a' + d - 10;
+            n /= base;
+        } while (n);
+        while (i) {
+            this->put(digits[--i]);
+        }
+    }
+
+    // Format string in flash.
+    void format(const char* format, const int32_t* args, uint8_t count) {
+        uint8_t arg = 0;
+        for (const char* p = format;; p++) {
+            char c = pgm_read_byte(p);
+            if (!c) {
+                return;
+            }
+            if (c != '%') {
+                this->put(c);
+                continue;
+            }
+            // Length modifiers don't matter, all the arguments are 32 bits.
+            do {
+                c = pgm_read_byte(++p);
+            } while (c == 'l' || c == 'h');
+            if (!c) {
+                return;
+            }
+            if (c == '%') {
+                this->put('%');
+                continue;
+            }
+            const int32_t v = arg < count ? args[arg++] : 0;
+            switch (c) {
+                case 'd':
+                case 'i':
+                    if (v < 0) {
+                        this->put('-');
+                        this->number(-(uint32_t)v, 10);
+                    } else {
+                        this->number(v, 10);
+                    }
+                    break;
+                case 'u':
+                    this->number(v, 10);
+                    break;
+                case 'x':
+                    this->number(v, 16);
+                    break;
+                case 'c':
+                    this->put(v);
+                    break;
+                default:
+                    this->put('?');
+                    break;
+            }
+        }
+    }
+
+    // Print the line if it fits in what the output can take, false otherwise.
+    bool flush(Print& out) {
+        this->_buf[this->_len++] = '\r';
+        this->_buf[this->_len++] = '\n';
+        if (out.availableForWrite() < this->_len) {
+            return false;
+        }
+        out.write((const uint8_t*)this->_buf, this->_len);
+        return true;
+    }
+
+   private:
+    char _buf[LOG_LINE_SIZE];
+    uint8_t _len = 0;
+};
+
+bool Logger::drain(Print& out) {
+    if (this->_head == this->_tail && this->_unreported) {
+        LineWriter line;
+        const int32_t count = this->_unreported;
+        line.format(droppedFormat, &count, 1);
+        if (!line.flush(out)) {
+            return false;
+        }
+        this->_unreported = 0;
+        return true;
+    }
+
+    if (this->_head == this->_tail) {
+        return false;
+    }
+    uint8_t header;
+    const char* format;
+    int32_t args[LOG_MAX_ARGS];
+    this->read(this->_tail, &header, 1);
+    this->read((this->_tail + 1) & (LOG_RING_SIZE - 1), &format, sizeof(format));
+    const uint8_t count = header & 0x0f;
+    this->read((this->_tail + headerSize) & (LOG_RING_SIZE - 1), args, count * sizeof(int32_t));
+
+    LineWriter line;
+    line.put(pgm_read_byte(&levelNames[header >> 4]));
+    line.put(' ');
+    line.format(format, args, count);
+    if (!line.flush(out)) {
+        return false;
+    }
+    this->_tail = (this->_tail + headerSize + count * sizeof(int32_t)) & (LOG_RING_SIZE - 1);
+    return true;
+}
@@ -1,70 +1,170 @@
+#include "chainedshiftboard.h"
 #include "cube.h"
+#include "cubechain.h"
 #include "effects.h"
+#include "fanoutboard.h"
+#include "frametap.h"
+#include "governor.h"
 #include "iboard.h"
+#include "log.h"
+#include "metrics.h"
+#include "playlist.h"
 #include "shiftpulseboard.h"
 #include "spiboard.h"
+#include "vm.h"
 
-// overrides getVoxel to match the physical wiring of the cube controller.
-int getVoxel(const ICubeRO& cube, int x, int y, int z) {
-    if (x % 2 == 0) {
-        return cube.getVoxel(x + 1, y, 7 - z);
-    }
-    return cube.getVoxel(x - 1, 7 - y, 7 - z);
-}
+// Physical wiring of the cube controller: neighbor rows swapped, every other row and the layers upside down.
+constexpr Wiring controllerWiring = {{1, 0, 3, 2, 5, 4, 7, 6}, 0xaa, true};
 
-IBoard* const boards[] = {
-    // new SPIBoard(SCK, SS, MOSI),
-    new ShiftPulseBoard(SCK, SS, MOSI),
+ShiftPulseBoard shiftPulseBoard(SCK, SS, MOSI);
+// SPIBoard spiBoard(SCK, SS, MOSI);
+// Two cubes chained on the same lines, render a CubeChain<2> to use them as a 16x8x8 volume.
+// ChainedShiftBoard<2, SPIBoard> chainedBoard(SCK, SS, MOSI);
+
+// Every board of the list shows the cube, serialized once for all of them, see FanOutBoard.
+IShiftBoard* const boards[] = {
+    // &spiBoard,
+    &shiftPulseBoard,
 };
-IBoard* board = boards[0];
+FanOutBoard<sizeof(boards) / sizeof(boards[0])> fanOut;
+// A chained board shows a whole CubeChain, drive it alone instead:
+// ILayerBoard& board = chainedBoard;
+ILayerBoard& board = fanOut;
+
+// Target refresh rate of the full cube, in frames per second.
+#ifndef REFRESH_RATE
+#define REFRESH_RATE 100
+#endif
+
+Governor governor(board, REFRESH_RATE);
 
 Cube cube;
 
-IEffect* effects[] = {
-    // new Rain(100, 5, +Plane::X),
-    // new Rain(100, 5, -Plane::X),
-    // new Rain(100, 5, +Plane::Y),
-    // new Rain(100, 5, -Plane::Y),
-    // new Rain(100, 5, +Plane::Z),
-    new Rain(100, 5, -Plane::Z),
-
-    // new SendVoxels(50, Plane::X),
-    // new SendVoxels(50, Plane::Y),
-    new SendVoxels(50, Plane::Z),
-
-    new VoxelExplorer(100),
-    new PlaneBoing(100),
-    new FullyOn(),
-    new WoopWoop(100),
-    new CubeJump(50),
-    new Glowing(),
-    new Numbers(100, +Plane::Y),
-
-    0,
-};
+EffectCycler cycler(10000, registry);
+
+// Programs uploaded over Serial, or HTTP on the ESP8266, replace the bytecode effect and pin it.
+Bytecode* programTarget() {
+    cycler = EffectCycler::mode::fixed;
+    cycler = bytecodeEffect;
+    return static_cast<Bytecode*>(cycler.current());
+}
+
+ProgramLoader programLoader(programTarget);
+
+ProgramLoader::status loadProgram(uint8_t b, unsigned long currentTime) {
+    const ProgramLoader::status status = programLoader.feed(b, currentTime);
+    switch (status) {
+        case ProgramLoader::done:
+            LOG_INFO("Program loaded");
+            cube.clear();
+            cycler.current()->init(cube);
+            break;
+        case ProgramLoader::failed:
+            LOG_WARN("Invalid program");
+            break;
+        default:
+            break;
+    }
+    return status;
+}
+
+#ifndef SERIAL_BAUD
+#define SERIAL_BAUD 9600
+#endif
 
-EffectCycler cycler(10000, effects);
+// Build with -DFRAME_TAP to mirror the displayed frames on Serial, see FrameTap. It sends about 13
+// frames per second at 9600 bauds, 50 at 115200, see the tap env.
+#ifdef FRAME_TAP
+FrameTap frameTap;
+#endif
+
+// Print the log in the idle time of the frames, and the tapped frames between its lines.
+bool drainSerial() {
+#ifdef FRAME_TAP
+    // Neither cuts the other, and the log goes first so the frames can't starve it.
+    if (frameTap.busy() || !logger.pending()) {
+        return frameTap.drain(Serial);
+    }
+    return logger.drain(Serial);
+#else
+    return logger.drain(Serial);
+#endif
+}
+
+#ifdef ESP8266
+void setupWiFi();
+void loopWiFi();
+
+// Timings served on /metrics, see wifi.cpp.
+Metrics metrics;
+
+// Runtime values of the metrics page, wifi.cpp adds the heap and WiFi ones.
+MetricsGauges runtimeGauges() {
+    MetricsGauges gauges = {};
+    gauges.fps = governor.fps();
+    gauges.framesDropped = governor.framesDropped();
+    gauges.inputDropped = AudioInput::active() ? AudioInput::active()->overruns() : 0;
+    gauges.effect = cycler.index();
+    return gauges;
+}
+#endif
 
 void setup() {
-    Serial.begin(9600);
+    Serial.begin(SERIAL_BAUD);
     Serial.println("");
     Serial.println("Starting!");
+    registry.report(Serial);
 
-    randomSeed(analogRead(0));
-    board->setup();
-    board->setMapping(getVoxel);
+#ifdef RNG_SEED
+    // Fixed seed for reproducible runs.
+    registry.rng().seed(RNG_SEED);
+#else
+    registry.rng().seed(analogRead(0));
+#endif
+    for (uint8_t i = 0; i < sizeof(boards) / sizeof(boards[0]); i++) {
+        fanOut.setOutput(i, *boards[i], &controllerWiring);
+    }
+    board.setup();
+    governor.setIdle(drainSerial);
+    // chainedBoard.setWiring(0, controllerWiring);
+    // chainedBoard.setWiring(1, controllerWiring);
 
-    //cycler = new Numbers(1000, -Plane::Y);
-    cycler = new Glowing();
-    //cycler = cycler[0];
+    // cycler = 9;  // Numbers.
+    cycler = EffectCycler::mode::fixed;
+    cycler = 8;  // Glowing.
     cycler.current()->init(cube);
+
+#ifdef ESP8266
+    setupWiFi();
+#endif
 }
 
 void loop() {
     unsigned long currentTime = ::millis();
+#ifdef ESP8266
+    const unsigned long workStart = ::micros();
+#endif
+
+    while (Serial.available()) {
+        loadProgram(Serial.read(), currentTime);
+    }
+#ifdef ESP8266
+    loopWiFi();
+#endif
 
     cycler.loop(currentTime, cube);
+#ifdef ESP8266
+    const unsigned long effectStart = ::micros();
+    cycler.current()->loop(currentTime, cube);
+    const unsigned long workEnd = ::micros();
+    metrics.effect(cycler.index(), workEnd - effectStart);
+    metrics.loop(workEnd, workEnd - workStart);
+#else
     cycler.current()->loop(currentTime, cube);
+#endif
 
-    board->render(cube);
+#ifdef FRAME_TAP
+    frameTap.capture(cube, cycler.index(), currentTime);
+#endif
+    governor.frame(cube);
 }
@@ -0,0 +1,95 @@
+#include "metrics.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+// PageWriter appends whole lines to a fixed buffer, lines that don't fit are dropped.
+class PageWriter {
+   public:
+    PageWriter(char* buf, size_t size) : _buf(buf), _size(size) {
+        if (size) {
+            buf[0] = 0;
+        }
+    }
+
+    void line(const char* fmt, ...) {
+        if (this->_full) {
+            return;
+        }
+        va_list args;
+        va_start(args, fmt);
+        const int n = vsnprintf(this->_buf + this->_len, this->_size - this->_len, fmt, args);
+        va_end(args);
+        if (n < 0 || (size_t)n + 1 >= this->_size - this->_len) {
+            this->_buf[this->_len] = 0;
+            this->_full = true;
+            return;
+        }
+        this->_len += n;
+        this->_buf[this->_len++] = '\n';
+        this->_buf[this->_len] = 0;
+    }
+
+    // Metric header, then the samples go through line.
+    void metric(const char* name, const char* type, const char* help) {
+        this->line("# HELP %s %s", name, help);
+        this->line("# TYPE %s %s", name, type);
+    }
+
+    size_t length() const {
+        return this->_len;
+    }
+
+   private:
+    char* _buf;
+    size_t _size;
+    size_t _len = 0;
+    bool _full = false;
+};
+
+size_t Metrics::format(char* buf, size_t size, const MetricsGauges& gauges) const {
+    PageWriter page(buf, size);
+
+    page.metric("ledcube_fps", "gauge", "Frames displayed during the last second.");
+    page.line("ledcube_fps %u", gauges.fps);
+    page.metric("ledcube_frames_dropped_total", "counter", "Frame slots skipped as the loop ran late.");
+    page.line("ledcube_frames_dropped_total %lu", (unsigned long)gauges.framesDropped);
+    page.metric("ledcube_input_dropped_total", "counter", "Audio samples lost by the active input.");
+    page.line("ledcube_input_dropped_total %lu", (unsigned long)gauges.inputDropped);
+
+    page.metric("ledcube_loop_work_microseconds", "gauge", "Loop time between two frames over the last second.");
+    page.line("ledcube_loop_work_microseconds{stat=\"avg\"} %lu", (unsigned long)this->_loopAvgLast);
+    page.line("ledcube_loop_work_microseconds{stat=\"max\"} %lu", (unsigned long)this->_loopMaxLast);
+
+    page.metric("ledcube_effect", "gauge", "Index of the active effect.");
+    page.line("ledcube_effect %d", gauges.effect);
+
+    // Only the effects which ran, the number of lines is still bounded by METRICS_MAX_EFFECTS.
+    page.metric("ledcube_effect_loop_microseconds_total", "counter", "Time spent in the effect loop, steps included.");
+    for (int i = 0; i < METRICS_MAX_EFFECTS; i++) {
+        if (this->_effects[i].calls) {
+            page.line("ledcube_effect_loop_microseconds_total{effect=\"%d\"} %lu", i, (unsigned long)this->_effects[i].total);
+        }
+    }
+    page.metric("ledcube_effect_loop_calls_total", "counter", "Calls of the effect loop.");
+    for (int i = 0; i < METRICS_MAX_EFFECTS; i++) {
+        if (this->_effects[i].calls) {
+            page.line("ledcube_effect_loop_calls_total{effect=\"%d\"} %lu", i, (unsigned long)this->_effects[i].calls);
+        }
+    }
+    page.metric("ledcube_effect_step_max_microseconds", "gauge", "Longest effect loop call, i.e. its heaviest step.");
+    for (int i = 0; i < METRICS_MAX_EFFECTS; i++) {
+        if (this->_effects[i].calls) {
+            page.line("ledcube_effect_step_max_microseconds{effect=\"%d\"} %lu", i, (unsigned long)this->_effects[i].max);
+        }
+    }
+
+    page.metric("ledcube_free_heap_bytes", "gauge", "Free heap.");
+    page.line("ledcube_free_heap_bytes %lu", (unsigned long)gauges.freeHeap);
+    page.metric("ledcube_heap_fragmentation_percent", "gauge", "Heap fragmentation.");
+    page.line("ledcube_heap_fragmentation_percent %u", gauges.heapFragmentation);
+    page.metric("ledcube_wifi_rssi_dbm", "gauge", "WiFi signal strength.");
+    page.line("ledcube_wifi_rssi_dbm %d", gauges.rssi);
+
+    return page.length();
+}
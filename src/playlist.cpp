@@ -0,0 +1,115 @@
+#include "playlist.h"
+
+#include "baked.h"
+#include "effects.h"
+#include "programs/planeboing.h"
+#include "programs/rain.h"
+#include "vm.h"
+
+// Max amount of RAM the effect arena is allowed to use.
+#ifndef EFFECT_ARENA_BUDGET
+#ifdef __AVR__
+// The Uno has 2KB. Outside the arena, the static RAM takes about 700 bytes: cube, boards, logger, governor,
+// program loader, Serial buffers, vtables and strings. This budget leaves about 700 bytes of stack, the
+// steps put up to a couple of 64 bytes frames on it. The bytecode effect is the largest, about 570 bytes.
+#define EFFECT_ARENA_BUDGET 640
+#else
+#define EFFECT_ARENA_BUDGET 4096
+#endif
+#endif
+
+// Effect factories, only the active effect is constructed, in place in the arena.
+// Rain and SendVoxels run along Z, the other directions are the same effect reoriented.
+// EFFECT_FACTORY(rainPosX, Oriented<Rain>, View::align(-Plane::Z, +Plane::X), 100, 5);
+// EFFECT_FACTORY(rainNegX, Oriented<Rain>, View::align(-Plane::Z, -Plane::X), 100, 5);
+// EFFECT_FACTORY(rainPosY, Oriented<Rain>, View::align(-Plane::Z, +Plane::Y), 100, 5);
+// EFFECT_FACTORY(rainNegY, Oriented<Rain>, View::align(-Plane::Z, -Plane::Y), 100, 5);
+// EFFECT_FACTORY(rainPosZ, Oriented<Rain>, View::align(-Plane::Z, +Plane::Z), 100, 5);
+EFFECT_FACTORY(rainNegZ, Rain, 100, 5);
+
+// EFFECT_FACTORY(sendVoxelsX, Oriented<SendVoxels>, View::swap(Plane::x, Plane::z), 50);
+// EFFECT_FACTORY(sendVoxelsY, Oriented<SendVoxels>, View::swap(Plane::y, Plane::z), 50);
+EFFECT_FACTORY(sendVoxelsZ, SendVoxels, 50);
+EFFECT_FACTORY(fireworks, Fireworks, 30);
+
+// The effects without randomness replay their frames from flash when baked.h has them within the budget,
+// the step interval stays the one of the effect. Regenerate with `ledcube bake include/baked.h` on change.
+#ifdef BAKED_VOXEL_EXPLORER
+EFFECT_FACTORY(voxelExplorer, CachedEffect, bakedVoxelExplorer, 100);
+#else
+EFFECT_FACTORY(voxelExplorer, VoxelExplorer, 100);
+#endif
+#ifdef BAKED_PLANE_BOING
+EFFECT_FACTORY(planeBoing, CachedEffect, bakedPlaneBoing, 100);
+#else
+EFFECT_FACTORY(planeBoing, PlaneBoing, 100);
+#endif
+#ifdef BAKED_FULLY_ON
+EFFECT_FACTORY(fullyOn, CachedEffect, bakedFullyOn, 1000);
+#else
+EFFECT_FACTORY(fullyOn, FullyOn);
+#endif
+#ifdef BAKED_WOOP_WOOP
+EFFECT_FACTORY(woopWoop, CachedEffect, bakedWoopWoop, 100);
+#else
+EFFECT_FACTORY(woopWoop, WoopWoop, 100);
+#endif
+EFFECT_FACTORY(cubeJump, CubeJump, 50);
+EFFECT_FACTORY(glowing, Glowing);
+EFFECT_FACTORY(numbers, Numbers, 100, +Plane::Y);
+#ifdef BAKED_SINE_WAVE
+EFFECT_FACTORY(sineWave, CachedEffect, bakedSineWave, 20);
+#else
+EFFECT_FACTORY(sineWave, SineWave, 20);
+#endif
+#ifdef BAKED_RIPPLE
+EFFECT_FACTORY(ripple, CachedEffect, bakedRipple, 20);
+#else
+EFFECT_FACTORY(ripple, Ripple, 20);
+#endif
+#ifdef BAKED_PLASMA
+EFFECT_FACTORY(plasma, CachedEffect, bakedPlasma, 20);
+#else
+EFFECT_FACTORY(plasma, Plasma, 20);
+#endif
+EFFECT_FACTORY(spectrum, Spectrum, 30);
+EFFECT_FACTORY(life4555, Life3D, 200, LifeRule::bays(4, 5, 5, 5));
+EFFECT_FACTORY(life5766, Life3D, 200, LifeRule::bays(5, 7, 6, 6), false);
+
+// Bytecode ports of Rain and PlaneBoing, see programs/. Uploaded programs replace the first one.
+EFFECT_FACTORY(vmRain, Bytecode, rainProgram);
+EFFECT_FACTORY(vmPlaneBoing, Bytecode, planeboingProgram);
+
+constexpr EffectEntry effects[] PROGMEM = {
+    EFFECT_ENTRY(rainNegZ),
+    EFFECT_ENTRY(sendVoxelsZ),
+    EFFECT_ENTRY(fireworks),
+    EFFECT_ENTRY(voxelExplorer),
+    EFFECT_ENTRY(planeBoing),
+    EFFECT_ENTRY(fullyOn),
+    EFFECT_ENTRY(woopWoop),
+    EFFECT_ENTRY(cubeJump),
+    EFFECT_ENTRY(glowing),
+    EFFECT_ENTRY(numbers),
+    EFFECT_ENTRY(sineWave),
+    EFFECT_ENTRY(ripple),
+    EFFECT_ENTRY(plasma),
+    EFFECT_ENTRY(spectrum),
+    EFFECT_ENTRY(life4555),
+    EFFECT_ENTRY(life5766),
+    EFFECT_ENTRY(vmRain),
+    EFFECT_ENTRY(vmPlaneBoing),
+};
+
+// The arena is sized at compile time on the largest effect.
+constexpr size_t effectArenaBytes = effectArenaSize(effects);
+static_assert(effectArenaBytes <= EFFECT_ARENA_BUDGET, "effect arena exceeds EFFECT_ARENA_BUDGET");
+
+extern const int bytecodeEffect = effectIndex(effects, &vmRain::create);
+
+extern const EffectEntry* const playlist = effects;
+extern const int playlistSize = sizeof(effects) / sizeof(effects[0]);
+extern const size_t playlistArenaSize = effectArenaBytes;
+
+EffectArena<effectArenaBytes> arena;
+EffectRegistry registry(effects, arena);
@@ -0,0 +1,338 @@
+#include "vm.h"
+
+static const uint8_t _operands[vm_count] PROGMEM = {
+#define VM_OPERANDS(name, mnemonic, operands) operands,
+    VM_OPS(VM_OPERANDS)
+#undef VM_OPERANDS
+};
+
+uint8_t vmOperands(uint8_t op) {
+    return pgm_read_byte(&_operands[op]);
+}
+
+static uint16_t readWord(const uint8_t* p) {
+    return p[0] | p[1] << 8;
+}
+
+bool VmHeader::parse(const uint8_t bytes[VM_HEADER_SIZE]) {
+    if (bytes[0] != 'L' || bytes[1] != 'V' || bytes[2] != VM_VERSION) {
+        return false;
+    }
+    this->interval = readWord(bytes + 3);
+    this->init = readWord(bytes + 5);
+    this->step = readWord(bytes + 7);
+    this->size = readWord(bytes + 9);
+    return true;
+}
+
+Bytecode::Bytecode(const uint8_t* image) {
+    if (!image) {
+        return;
+    }
+    uint8_t bytes[VM_HEADER_SIZE];
+    memcpy_P(bytes, image, VM_HEADER_SIZE);
+    VmHeader header;
+    if (!header.parse(bytes) || header.size > VM_PROGRAM_SIZE) {
+        return;
+    }
+    memcpy_P(this->_code, image + VM_HEADER_SIZE, header.size);
+    this->start(header);
+}
+
+// Whether the given jump target or entry point is the start of an instruction, or the halt past the end.
+static bool isStart(const uint8_t* starts, uint16_t size, uint16_t pc) {
+    return pc == size || (pc < size && (starts[pc >> 3] >> (pc & 7) & 1));
+}
+
+// Walk the code once so the interpreter doesn't have to check the opcodes, the operands nor the jumps.
+// Jumps and entry points must land on an instruction: within an operand, the operand would run as opcodes.
+bool Bytecode::start(const VmHeader& header) {
+    this->_valid = false;
+    if (header.size > VM_PROGRAM_SIZE) {
+        return false;
+    }
+    const uint8_t* code = this->_code;
+    // Bit per instruction start.
+    uint8_t starts[(VM_PROGRAM_SIZE + 7) / 8];
+    memset(starts, 0, sizeof(starts));
+    for (uint16_t pc = 0; pc < header.size;) {
+        starts[pc >> 3] |= 1 << (pc & 7);
+        const uint8_t op = code[pc++];
+        if (op >= vm_count) {
+            return false;
+        }
+        const uint8_t kind = vmOperands(op);
+        if (pc + vmOperandSize(kind) > header.size) {
+            return false;
+        }
+        if (kind == VM_VAR || kind == VM_VAR_ADDR) {
+            if (code[pc] >= VM_VARIABLES) {
+                return false;
+            }
+        }
+        pc += vmOperandSize(kind);
+    }
+    if (!isStart(starts, header.size, header.init) || !isStart(starts, header.size, header.step)) {
+        return false;
+    }
+    // The code is well formed from here, walk it again for the jump targets.
+    for (uint16_t pc = 0; pc < header.size;) {
+        const uint8_t kind = vmOperands(code[pc++]);
+        if (kind == VM_ADDR || kind == VM_VAR_ADDR) {
+            if (!isStart(starts, header.size, readWord(code + pc + (kind == VM_VAR_ADDR ? 1 : 0)))) {
+                return false;
+            }
+        }
+        pc += vmOperandSize(kind);
+    }
+    // Running off the end halts.
+    this->_code[header.size] = vm_halt;
+
+    this->_header = header;
+    memset(this->_vars, 0, sizeof(this->_vars));
+    this->_last = 0;
+    this->_valid = true;
+    return true;
+}
+
+static Plane vmPlane(int16_t axis, int16_t offset = 0) {
+    const int16_t a = axis < 0 ? -axis : axis;
+    return Plane(a == 2 ? Plane::axis::y : a == 3 ? Plane::axis::z : Plane::axis::x,
+                 offset & 7,
+                 axis < 0 ? Plane::direction::negative : Plane::direction::positive);
+}
+
+// Threaded dispatch: each handler jumps straight to the next one through the label table,
+// instead of going back to a switch.
+void Bytecode::run(ICube& cube, uint16_t pc) {
+    static const void* const labels[vm_count] PROGMEM = {
+#define VM_LABEL(name, mnemonic, operands) &&op_##name,
+        VM_OPS(VM_LABEL)
+#undef VM_LABEL
+    };
+
+    const uint8_t* const code = this->_code;
+    int16_t* const vars = this->_vars;
+    int16_t stack[VM_STACK_SIZE];
+    uint8_t sp = 0;
+    uint16_t budget = VM_JUMP_BUDGET;
+    int16_t a, b, c;
+
+#define PUSH(v) (stack[sp++ & (VM_STACK_SIZE - 1)] = (v))
+#define POP() (stack[--sp & (VM_STACK_SIZE - 1)])
+#define TOP() (stack[(sp - 1) & (VM_STACK_SIZE - 1)])
+#define WORD() (pc += 2, (int16_t)readWord(code + pc - 2))
+#define JUMP(target)                 \
+    do {                             \
+        const uint16_t t = (target); \
+        if (!--budget) {             \
+            return;                  \
+        }                            \
+        pc = t;                      \
+    } while (0)
+#define NEXT() goto*(const void*)pgm_read_ptr(&labels[code[pc++]])
+
+    NEXT();
+
+op_halt:
+    return;
+op_push8:
+    PUSH((int8_t)code[pc++]);
+    NEXT();
+op_push16:
+    PUSH(WORD());
+    NEXT();
+op_load:
+    PUSH(vars[code[pc++]]);
+    NEXT();
+op_store:
+    vars[code[pc++]] = POP();
+    NEXT();
+op_dup:
+    a = TOP();
+    PUSH(a);
+    NEXT();
+op_drop:
+    sp--;
+    NEXT();
+op_swap:
+    a = POP();
+    b = POP();
+    PUSH(a);
+    PUSH(b);
+    NEXT();
+op_over:
+    a = POP();
+    b = TOP();
+    PUSH(a);
+    PUSH(b);
+    NEXT();
+op_add:
+    a = POP();
+    TOP() += a;
+    NEXT();
+op_sub:
+    a = POP();
+    TOP() -= a;
+    NEXT();
+op_mul:
+    a = POP();
+    TOP() *= a;
+    NEXT();
+op_mod:
+    a = POP();
+    TOP() = a ? TOP() % a : 0;
+    NEXT();
+op_band:
+    a = POP();
+    TOP() &= a;
+    NEXT();
+op_bor:
+    a = POP();
+    TOP() |= a;
+    NEXT();
+op_bxor:
+    a = POP();
+    TOP() ^= a;
+    NEXT();
+op_shl:
+    a = POP();
+    TOP() = (uint16_t)TOP() << (a & 15);
+    NEXT();
+op_shr:
+    a = POP();
+    TOP() = (uint16_t)TOP() >> (a & 15);
+    NEXT();
+op_neg:
+    TOP() = -TOP();
+    NEXT();
+op_lnot:
+    TOP() = !TOP();
+    NEXT();
+op_lt:
+    a = POP();
+    TOP() = TOP() < a;
+    NEXT();
+op_gt:
+    a = POP();
+    TOP() = TOP() > a;
+    NEXT();
+op_eq:
+    a = POP();
+    TOP() = TOP() == a;
+    NEXT();
+op_jmp:
+    JUMP(readWord(code + pc));
+    NEXT();
+op_jz:
+    if (POP()) {
+        pc += 2;
+    } else {
+        JUMP(readWord(code + pc));
+    }
+    NEXT();
+op_jnz:
+    if (POP()) {
+        JUMP(readWord(code + pc));
+    } else {
+        pc += 2;
+    }
+    NEXT();
+op_loop:
+    if (--vars[code[pc]]) {
+        JUMP(readWord(code + pc + 1));
+    } else {
+        pc += 3;
+    }
+    NEXT();
+op_rand:
+    a = TOP();
+    TOP() = a > 0 ? this->rng().below(a) : 0;
+    NEXT();
+op_set:
+    a = POP();
+    c = POP();
+    b = POP();
+    cube.setVoxel(POP() & 7, b & 7, c & 7, a);
+    NEXT();
+op_get:
+    c = POP();
+    b = POP();
+    a = POP();
+    PUSH(cube.getVoxel(a & 7, b & 7, c & 7));
+    NEXT();
+op_row:
+    b = POP();
+    a = POP();
+    PUSH(cube.getRow(a & 7, b & 7));
+    NEXT();
+op_setrow:
+    c = POP();
+    b = POP();
+    a = POP();
+    cube.setRow(a & 7, b & 7, c);
+    NEXT();
+op_fill:
+    c = POP();
+    b = POP();
+    a = POP();
+    cube.fill(vmPlane(a, b), c);
+    NEXT();
+op_shift:
+    cube.shift(vmPlane(POP()));
+    NEXT();
+op_clear:
+    cube.clear();
+    NEXT();
+
+#undef PUSH
+#undef POP
+#undef TOP
+#undef WORD
+#undef JUMP
+#undef NEXT
+}
+
+ProgramLoader::status ProgramLoader::feed(uint8_t b, unsigned long currentTime) {
+    if (this->_pos && currentTime - this->_last > 1000) {
+        this->_pos = 0;
+    }
+    this->_last = currentTime;
+
+    // Header, waiting for the magic.
+    if (this->_pos < VM_HEADER_SIZE) {
+        if ((this->_pos == 0 && b != 'L') || (this->_pos == 1 && b != 'V')) {
+            this->_pos = 0;
+            return idle;
+        }
+        if (this->_pos == 0) {
+            this->_sum = 0;
+        }
+        this->_sum += b;
+        this->_bytes[this->_pos++] = b;
+        if (this->_pos < VM_HEADER_SIZE) {
+            return loading;
+        }
+        if (!this->_header.parse(this->_bytes) || this->_header.size > VM_PROGRAM_SIZE || !(this->_vm = this->_target())) {
+            this->_pos = 0;
+            return failed;
+        }
+        return loading;
+    }
+
+    // Code, straight into the slot.
+    const uint16_t offset = this->_pos - VM_HEADER_SIZE;
+    if (offset < this->_header.size) {
+        this->_vm->slot()[offset] = b;
+        this->_sum += b;
+        this->_pos++;
+        return loading;
+    }
+
+    // Checksum.
+    this->_pos = 0;
+    if (b != this->_sum || !this->_vm->start(this->_header)) {
+        return failed;
+    }
+    return done;
+}
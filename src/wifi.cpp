@@ -6,9 +6,44 @@
 
 #include "credentials.h"
 #include "cube.h"
+#include "log.h"
+#include "metrics.h"
+#include "vm.h"
 
 ESP8266WebServer server(80);
 
+// Defined in main.cpp, feeds the bytecode program loader.
+ProgramLoader::status loadProgram(uint8_t b, unsigned long currentTime);
+
+// Loader status of the upload in progress, a failure sticks until the next upload.
+static ProgramLoader::status uploadStatus = ProgramLoader::idle;
+
+// Defined in main.cpp, timings and runtime values of the metrics page.
+extern Metrics metrics;
+MetricsGauges runtimeGauges();
+
+// Metrics page being sent, a slice per loop.
+static MetricsSender<WiFiClient> metricsSender;
+
+// Prometheus scrape target. The page is formatted in a static buffer with a bounded number of lines,
+// a scrape costs about the same every time and doesn't touch the heap. Only the headers go out here,
+// metricsSender streams the page over the next loops. It takes about a dozen loops, well within the 2s
+// the server keeps a connection open after its handler.
+void handleMetrics() {
+    if (metricsSender.busy()) {
+        server.send(503, "text/plain", "scrape in progress\n");
+        return;
+    }
+
+    MetricsGauges gauges = runtimeGauges();
+    gauges.freeHeap = ESP.getFreeHeap();
+    gauges.heapFragmentation = ESP.getHeapFragmentation();
+    gauges.rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+
+    server.setContentLength(metricsSender.start(metrics, gauges, server.client()));
+    server.send(200, "text/plain; version=0.0.4", "");
+}
+
 void handleRoot() {
     server.send(200, "text/plain", "hello from esp8266!");
 }
@@ -28,18 +63,14 @@ void handleNotFound() {
     server.send(404, "text/plain", message);
 }
 
+// Whether the HTTP server listens, once the first connection is up.
+static bool serverStarted = false;
+
+// Connect in the background, the cube displays right away and the server starts from loopWiFi.
 void setupWiFi() {
     WiFi.hostname("esptest1");
     WiFi.begin(WIFI_SSID, WIFI_PW);
-
-    Serial.print("Connecting");
-    while (WiFi.status() != WL_CONNECTED) {
-        delay(500);
-        Serial.print(".");
-    }
-    Serial.println();
-    Serial.print("Connected, IP address: ");
-    Serial.println(WiFi.localIP());
+    LOG_INFO("WiFi connecting");
 
     server.on("/", handleRoot);
 
@@ -63,13 +94,57 @@ void setupWiFi() {
         server.send(200, "image/gif", gif_colored, sizeof(gif_colored));
     });
 
-    server.onNotFound(handleNotFound);
+    // Upload a bytecode program, ex: curl -F program=@rain.lcv http://<cube>/program
+    // Replies 200 once the whole image is loaded and started, 400 otherwise.
+    server.on(
+        "/program", HTTP_POST, []() {
+            switch (uploadStatus) {
+                case ProgramLoader::done:
+                    server.send(200, "text/plain", "ok\n");
+                    break;
+                case ProgramLoader::failed:
+                    server.send(400, "text/plain", "invalid program\n");
+                    break;
+                case ProgramLoader::loading:
+                    server.send(400, "text/plain", "incomplete program\n");
+                    break;
+                default:
+                    server.send(400, "text/plain", "no program\n");
+                    break;
+            }
+        },
+        []() {
+            HTTPUpload& upload = server.upload();
+            if (upload.status == UPLOAD_FILE_START) {
+                uploadStatus = ProgramLoader::idle;
+            } else if (upload.status == UPLOAD_FILE_WRITE) {
+                for (size_t i = 0; i < upload.currentSize; i++) {
+                    const ProgramLoader::status status = loadProgram(upload.buf[i], ::millis());
+                    // Bytes around the image, waiting for its magic, leave the status as is.
+                    if (status != ProgramLoader::idle && uploadStatus != ProgramLoader::failed) {
+                        uploadStatus = status;
+                    }
+                }
+            }
+        });
+
+    server.on("/metrics", handleMetrics);
 
-    server.begin();
+    server.onNotFound(handleNotFound);
 }
 
 void loopWiFi() {
+    if (!serverStarted) {
+        if (WiFi.status() != WL_CONNECTED) {
+            return;
+        }
+        const IPAddress ip = WiFi.localIP();
+        LOG_INFO("WiFi connected, IP address: %u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+        server.begin();
+        serverStarted = true;
+    }
     server.handleClient();
+    metricsSender.send();
 }
 
 #endif
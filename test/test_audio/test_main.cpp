@@ -0,0 +1,79 @@
+// Spectrum bands of pure tones, see SpectrumAnalyzer. Run with `pio test -e native`.
+
+#include <Arduino.h>
+#include <math.h>
+#include <unity.h>
+
+#include "audio.h"
+
+// Enough blocks for the bias to settle, the bands are those of the last one.
+static const int blocks = 8;
+
+static uint16_t samples[blocks * AUDIO_BLOCK_SIZE];
+
+void setUp() {}
+void tearDown() {}
+
+// Play a tone through the ADC shim as the Spectrum effect samples it, 511 being full scale.
+static void analyze(double hz, int amplitude, SpectrumAnalyzer& analyzer) {
+    for (int i = 0; i < blocks * AUDIO_BLOCK_SIZE; i++) {
+        samples[i] = 512 + lround(amplitude * sin(2 * M_PI * hz * i * AUDIO_SAMPLE_PERIOD / 1e6));
+    }
+    native::setMicros(0);
+    native::setAnalogInput(samples, blocks * AUDIO_BLOCK_SIZE);
+
+    AudioInput input;
+    input.begin();
+    int fed = 0;
+    for (unsigned long t = 0; fed < blocks * AUDIO_BLOCK_SIZE; t += AUDIO_SAMPLE_PERIOD) {
+        native::setMicros(t);
+        input.poll();
+        uint8_t sample;
+        while (input.read(sample)) {
+            analyzer.feed(sample);
+            fed++;
+        }
+    }
+}
+
+// Tones at the band centers and in between, where single bins used to read nothing.
+static void test_tone_peaks_in_its_band() {
+    const struct {
+        double hz;
+        uint8_t band;
+    } tones[] = {
+        {75, 0}, {113, 1}, {150, 2}, {188, 2}, {263, 3}, {300, 4}, {376, 4},
+        {450, 5}, {526, 5}, {600, 6}, {751, 6}, {900, 7}, {1052, 7},
+    };
+    for (const auto& tone : tones) {
+        SpectrumAnalyzer analyzer;
+        analyze(tone.hz, 511, analyzer);
+        char message[64];
+        for (uint8_t b = 0; b < AUDIO_BANDS; b++) {
+            snprintf(message, sizeof(message), "%.0fHz, band %u = %u", tone.hz, b, analyzer.band(b));
+            if (b == tone.band) {
+                TEST_ASSERT_TRUE_MESSAGE(analyzer.band(b) >= 190 && analyzer.band(b) <= 260, message);
+            } else if (b + 1 < tone.band || b > tone.band + 1) {
+                // The window spreads a tone over a couple of bins, only into the next bands.
+                TEST_ASSERT_TRUE_MESSAGE(analyzer.band(b) <= 8, message);
+            } else {
+                TEST_ASSERT_TRUE_MESSAGE(analyzer.band(b) < analyzer.band(tone.band), message);
+            }
+        }
+    }
+}
+
+static void test_silence_reads_nothing() {
+    SpectrumAnalyzer analyzer;
+    analyze(0, 0, analyzer);
+    for (uint8_t b = 0; b < AUDIO_BANDS; b++) {
+        TEST_ASSERT_EQUAL_UINT16(0, analyzer.band(b));
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_tone_peaks_in_its_band);
+    RUN_TEST(test_silence_reads_nothing);
+    return UNITY_END();
+}
@@ -0,0 +1,44 @@
+// Fixed point helpers, see fixedmath.h. Run with `pio test -e native`.
+
+#include <Arduino.h>
+#include <math.h>
+#include <unity.h>
+
+#include "fixedmath.h"
+
+void setUp() {}
+void tearDown() {}
+
+// Within the documented 9% of the exact length.
+static void assertDist3(int16_t dx, int16_t dy, int16_t dz) {
+    const double exact = sqrt((double)dx * dx + (double)dy * dy + (double)dz * dz);
+    const uint16_t dist = approxDist(dx, dy, dz);
+    char message[64];
+    snprintf(message, sizeof(message), "approxDist(%d, %d, %d) = %u", dx, dy, dz, dist);
+    TEST_ASSERT_TRUE_MESSAGE(fabs(dist - exact) <= exact * 0.09, message);
+}
+
+// 11 x the middle component overflows 16 bits past 5957, as AVR computes it in unsigned int.
+static void test_approx_dist_3d_past_16_bits_products() {
+    TEST_ASSERT_EQUAL_UINT16(8000 + 5958 * 11 / 32, approxDist(8000, 5958, 0));
+    TEST_ASSERT_EQUAL_UINT16(8000 + 5958 * 11 / 32, approxDist(-5958, 0, -8000));
+    TEST_ASSERT_EQUAL_UINT16(6000 + 6000 * 11 / 32 + 6000 / 4, approxDist(6000, 6000, 6000));
+    assertDist3(8000, 5958, 0);
+    assertDist3(6000, 6000, 6000);
+    assertDist3(20000, 12000, 3000);
+}
+
+// Q8 offsets of a few voxels, as the effects use.
+static void test_approx_dist_3d_voxel_offsets() {
+    for (int16_t d = 1; d <= 32; d++) {
+        assertDist3(d * 256, d * 200, d * 100);
+        assertDist3(-d * 256, 0, d * 64);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_approx_dist_3d_past_16_bits_products);
+    RUN_TEST(test_approx_dist_3d_voxel_offsets);
+    return UNITY_END();
+}
@@ -0,0 +1,111 @@
+// Log ring and line formatting, see log.h. Run with `pio test -e native`.
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <string>
+
+#include "log.h"
+
+// UartPrint takes at most 63 bytes at once by default, as the Uno HardwareSerial reports of its 64 bytes
+// ring, less when room is lowered as if the ring still held previous output.
+class UartPrint : public Print {
+   public:
+    size_t write(uint8_t c) {
+        this->output += (char)c;
+        return 1;
+    }
+    using Print::write;
+    int availableForWrite() { return this->room; }
+
+    std::string output;
+    int room = 63;
+};
+
+void setUp() {}
+void tearDown() {}
+
+static void test_longest_line_fits_the_uno_tx_buffer() {
+    Logger log;
+    UartPrint out;
+    log.record(LOG_LEVEL_INFO, PSTR("a line much longer than what the Uno TX buffer can ever take at once: %u"), 12345);
+    log.record(LOG_LEVEL_WARN, PSTR("next"));
+
+    TEST_ASSERT_TRUE(log.drain(out));
+    TEST_ASSERT_EQUAL(LOG_LINE_SIZE, out.output.size());
+    TEST_ASSERT_EQUAL_STRING("\r\n", out.output.c_str() + out.output.size() - 2);
+    TEST_ASSERT_EQUAL_STRING("I a line much", out.output.substr(0, 13).c_str());
+
+    out.output.clear();
+    TEST_ASSERT_TRUE(log.drain(out));
+    TEST_ASSERT_EQUAL_STRING("W next\r\n", out.output.c_str());
+    TEST_ASSERT_FALSE(log.drain(out));
+    TEST_ASSERT_FALSE(log.pending());
+}
+
+// Drain up to the given number of lines, returns how many got printed.
+static int drainLines(Logger& log, Print& out, int max) {
+    int lines = 0;
+    while (lines < max && log.drain(out)) {
+        lines++;
+    }
+    return lines;
+}
+
+// A full ring drops the records rather than waiting, and keeps dropping until the drop report is printed
+// right after the records that made it, so the gap shows where it is.
+static void test_full_ring_drops_and_reports_the_gap() {
+    Logger log;
+    UartPrint out;
+    const int records = 1000;
+    for (int i = 0; i < records; i++) {
+        log.record(LOG_LEVEL_INFO, PSTR("n %d"), i);
+    }
+    const int kept = records - log.dropped();
+    TEST_ASSERT_GREATER_THAN(0, log.dropped());
+    TEST_ASSERT_GREATER_THAN(0, kept);
+
+    // Room again, but still dropping until the report is out.
+    TEST_ASSERT_EQUAL(1, drainLines(log, out, 1));
+    log.record(LOG_LEVEL_WARN, PSTR("during"));
+    TEST_ASSERT_EQUAL(records - kept + 1, log.dropped());
+
+    TEST_ASSERT_EQUAL(kept, drainLines(log, out, records));
+    log.record(LOG_LEVEL_WARN, PSTR("after"));
+    TEST_ASSERT_EQUAL(1, drainLines(log, out, records));
+    TEST_ASSERT_FALSE(log.pending());
+
+    std::string want;
+    char line[LOG_LINE_SIZE];
+    for (int i = 0; i < kept; i++) {
+        snprintf(line, sizeof(line), "I n %d\r\n", i);
+        want += line;
+    }
+    snprintf(line, sizeof(line), "log: %d records dropped\r\n", records - kept + 1);
+    want += line;
+    want += "W after\r\n";
+    TEST_ASSERT_EQUAL_STRING(want.c_str(), out.output.c_str());
+}
+
+// A line one byte longer than the room left is kept for a later drain, nothing of it is written.
+static void test_drain_waits_for_room() {
+    Logger log;
+    UartPrint out;
+    out.room = 11;
+    log.record(LOG_LEVEL_INFO, PSTR("effect %d"), 3);
+    TEST_ASSERT_FALSE(log.drain(out));
+    TEST_ASSERT_EQUAL(0, out.output.size());
+    TEST_ASSERT_TRUE(log.pending());
+
+    out.room = 12;
+    TEST_ASSERT_TRUE(log.drain(out));
+    TEST_ASSERT_EQUAL_STRING("I effect 3\r\n", out.output.c_str());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_longest_line_fits_the_uno_tx_buffer);
+    RUN_TEST(test_full_ring_drops_and_reports_the_gap);
+    RUN_TEST(test_drain_waits_for_room);
+    return UNITY_END();
+}
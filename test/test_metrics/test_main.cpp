@@ -0,0 +1,132 @@
+// Metrics page streaming, see MetricsSender. Run with `pio test -e native`.
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <string>
+
+#include "metrics.h"
+
+// A connection taking a few bytes per loop, copies share it as WiFiClient copies do.
+struct Connection {
+    std::string received;
+    int room = 0;
+    bool connected = true;
+};
+
+class SlowClient {
+   public:
+    SlowClient(Connection* connection = 0) : _connection(connection) {}
+
+    bool connected() const {
+        return this->_connection && this->_connection->connected;
+    }
+
+    int availableForWrite() const {
+        return this->_connection ? this->_connection->room : 0;
+    }
+
+    size_t write(const uint8_t* buf, size_t size) {
+        this->_connection->received.append((const char*)buf, size);
+        return size;
+    }
+
+   private:
+    Connection* _connection;
+};
+
+static Metrics metrics;
+static MetricsGauges gauges;
+static MetricsSender<SlowClient> sender;
+
+void setUp() {
+    for (int i = 0; i < METRICS_MAX_EFFECTS; i++) {
+        metrics.effect(i, 1000 + i);
+    }
+    metrics.loop(1000000, 250);
+    gauges.fps = 100;
+    gauges.effect = 3;
+}
+
+void tearDown() {}
+
+static std::string formatted() {
+    static char page[METRICS_PAGE_SIZE];
+    return std::string(page, metrics.format(page, sizeof(page), gauges));
+}
+
+// Scraped over several loops, a chunk or what the connection takes at most per loop.
+static void test_page_streams_over_several_loops() {
+    const int rooms[] = {300, 4096};
+    for (int room : rooms) {
+        Connection connection;
+        connection.room = room;
+        const std::string want = formatted();
+        TEST_ASSERT_EQUAL(want.size(), sender.start(metrics, gauges, SlowClient(&connection)));
+
+        int loops = 0;
+        while (sender.busy()) {
+            const size_t before = connection.received.size();
+            sender.send();
+            TEST_ASSERT_LESS_OR_EQUAL(room < 512 ? room : 512, connection.received.size() - before);
+            TEST_ASSERT_LESS_OR_EQUAL(100, ++loops);
+        }
+        TEST_ASSERT_GREATER_THAN(1, loops);
+        TEST_ASSERT_TRUE(connection.received == want);
+    }
+}
+
+// No room, nothing written, the page waits.
+static void test_full_connection_waits() {
+    Connection connection;
+    TEST_ASSERT_GREATER_THAN(0, sender.start(metrics, gauges, SlowClient(&connection)));
+    sender.send();
+    TEST_ASSERT_EQUAL(0, connection.received.size());
+    TEST_ASSERT_TRUE(sender.busy());
+
+    connection.connected = false;
+    sender.send();
+    TEST_ASSERT_FALSE(sender.busy());
+}
+
+// A second scrape while the page is pending is turned away, the first one completes.
+static void test_scrape_while_busy() {
+    Connection first, second;
+    first.room = second.room = 1024;
+    const std::string want = formatted();
+    TEST_ASSERT_EQUAL(want.size(), sender.start(metrics, gauges, SlowClient(&first)));
+    sender.send();
+    TEST_ASSERT_EQUAL(0, sender.start(metrics, gauges, SlowClient(&second)));
+    while (sender.busy()) {
+        sender.send();
+    }
+    TEST_ASSERT_TRUE(first.received == want);
+    TEST_ASSERT_EQUAL(0, second.received.size());
+
+    TEST_ASSERT_EQUAL(want.size(), sender.start(metrics, gauges, SlowClient(&second)));
+    while (sender.busy()) {
+        sender.send();
+    }
+    TEST_ASSERT_TRUE(second.received == want);
+}
+
+// The client going away ends the page.
+static void test_disconnect_ends_the_page() {
+    Connection connection;
+    connection.room = 100;
+    sender.start(metrics, gauges, SlowClient(&connection));
+    sender.send();
+    connection.connected = false;
+    sender.send();
+    TEST_ASSERT_FALSE(sender.busy());
+    TEST_ASSERT_EQUAL(100, connection.received.size());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_page_streams_over_several_loops);
+    RUN_TEST(test_full_connection_waits);
+    RUN_TEST(test_scrape_while_busy);
+    RUN_TEST(test_disconnect_ends_the_page);
+    return UNITY_END();
+}
@@ -0,0 +1,59 @@
+// Golden frame traces of the registered effects, see test/traces. Run with `pio test -e native` from the
+// project directory. After an intended change of an effect, record them again with
+// `.pio/build/native/program record-all test/traces 3`.
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "playlist.h"
+#include "trace.h"
+
+// Virtual duration and seed of the golden traces, the record-all defaults but for the duration.
+static const unsigned long traceSeconds = 3;
+static const unsigned long traceSeed = 1;
+
+static int effectIdx;
+
+void setUp() {}
+void tearDown() {}
+
+// Run the effect as record-all does and compare each record with its golden trace.
+static void test_effect_matches_golden_trace() {
+    char path[64];
+    snprintf(path, sizeof(path), "test/traces/effect-%d.trace", effectIdx);
+    FILE* golden = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL_MESSAGE(golden, path);
+
+    FILE* out = tmpfile();
+    TEST_ASSERT_NOT_NULL(out);
+    TraceRecorder recorder(out);
+    registry.rng().seed(traceSeed);
+    runEffect(registry.activate(effectIdx), traceSeconds, recorder);
+    rewind(out);
+
+    TraceReader want(golden), got(out);
+    TEST_ASSERT_TRUE_MESSAGE(want.valid(), path);
+    char message[128];
+    Frame wantFrame, gotFrame;
+    unsigned long wantTime, gotTime;
+    for (unsigned long record = 0;; record++) {
+        const bool more = want.next(wantFrame, wantTime);
+        snprintf(message, sizeof(message), "%s: record %lu", path, record);
+        TEST_ASSERT_EQUAL_MESSAGE(more, got.next(gotFrame, gotTime), message);
+        if (!more) {
+            break;
+        }
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(wantTime, gotTime, message);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(wantFrame.rows, gotFrame.rows, sizeof(wantFrame.rows), message);
+    }
+    fclose(golden);
+    fclose(out);
+}
+
+int main() {
+    UNITY_BEGIN();
+    for (effectIdx = 0; effectIdx < registry.size(); effectIdx++) {
+        RUN_TEST(test_effect_matches_golden_trace);
+    }
+    return UNITY_END();
+}
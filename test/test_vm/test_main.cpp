@@ -0,0 +1,100 @@
+// Program checks of the bytecode VM, see Bytecode::start. Run with `pio test -e native`.
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "programs/planeboing.h"
+#include "programs/rain.h"
+#include "vm.h"
+
+static Bytecode vm;
+
+static Bytecode* target() {
+    return &vm;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// Feed the program through the loader as Serial would, header and checksum included.
+static ProgramLoader::status load(uint16_t init, uint16_t step, const uint8_t* code, uint16_t size) {
+    const uint8_t header[VM_HEADER_SIZE] = {
+        'L', 'V', VM_VERSION,
+        10, 0,
+        (uint8_t)init, (uint8_t)(init >> 8),
+        (uint8_t)step, (uint8_t)(step >> 8),
+        (uint8_t)size, (uint8_t)(size >> 8),
+    };
+    ProgramLoader loader(target);
+    uint8_t sum = 0;
+    for (uint8_t b : header) {
+        sum += b;
+        loader.feed(b, 0);
+    }
+    for (uint16_t i = 0; i < size; i++) {
+        sum += code[i];
+        loader.feed(code[i], 0);
+    }
+    return loader.feed(sum, 0);
+}
+
+static void test_jumps_to_instructions_and_the_end() {
+    const uint8_t code[] = {
+        vm_push16, 1, 0,   // 0
+        vm_jnz, 9, 0,      // 3: to the end.
+        vm_jmp, 0, 0,      // 6: to the first instruction.
+    };
+    TEST_ASSERT_EQUAL(ProgramLoader::done, load(0, 3, code, sizeof(code)));
+}
+
+static void test_jump_into_an_operand() {
+    const uint8_t code[] = {
+        vm_push16, vm_store, 0xff,  // 0: the operand decodes as a store to var 255.
+        vm_jmp, 1, 0,               // 3: into the push16 operand.
+    };
+    TEST_ASSERT_EQUAL(ProgramLoader::failed, load(0, 0, code, sizeof(code)));
+}
+
+static void test_loop_into_an_operand() {
+    const uint8_t code[] = {
+        vm_push8, 8,       // 0
+        vm_store, 0,       // 2
+        vm_loop, 0, 3, 0,  // 4: into the store operand.
+    };
+    TEST_ASSERT_EQUAL(ProgramLoader::failed, load(0, 0, code, sizeof(code)));
+}
+
+static void test_entry_point_inside_an_operand() {
+    const uint8_t code[] = {
+        vm_push8, 0xff,  // 0: the operand is not an opcode.
+        vm_drop,         // 2
+    };
+    TEST_ASSERT_EQUAL(ProgramLoader::failed, load(1, 0, code, sizeof(code)));
+    TEST_ASSERT_EQUAL(ProgramLoader::failed, load(0, 1, code, sizeof(code)));
+    TEST_ASSERT_EQUAL(ProgramLoader::done, load(2, sizeof(code), code, sizeof(code)));
+}
+
+static void test_entry_point_past_the_end() {
+    const uint8_t code[] = {vm_clear};
+    TEST_ASSERT_EQUAL(ProgramLoader::failed, load(0, 2, code, sizeof(code)));
+}
+
+static void test_bundled_programs_start() {
+    const uint8_t* const images[] = {rainProgram, planeboingProgram};
+    for (const uint8_t* image : images) {
+        VmHeader header;
+        TEST_ASSERT_TRUE(header.parse(image));
+        TEST_ASSERT_EQUAL(ProgramLoader::done, load(header.init, header.step, image + VM_HEADER_SIZE, header.size));
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_jumps_to_instructions_and_the_end);
+    RUN_TEST(test_jump_into_an_operand);
+    RUN_TEST(test_loop_into_an_operand);
+    RUN_TEST(test_entry_point_inside_an_operand);
+    RUN_TEST(test_entry_point_past_the_end);
+    RUN_TEST(test_bundled_programs_start);
+    return UNITY_END();
+}